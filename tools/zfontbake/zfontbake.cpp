@@ -0,0 +1,259 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zfontbake.cpp
+* Desc: offline generator for the baked console glyph atlas
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+/*
+Rasterizes the console glyph set from the embedded font (zfontdata.hpp)
+and writes zfontatlas.hpp: an alpha atlas plus a constexpr metrics table,
+so the console can start without running FreeType.
+
+Build and run from this directory (FreeType 2 is the only dependency):
+	g++ -O2 zfontbake.cpp -I/usr/include/freetype2 -lfreetype -o zfontbake
+	./zfontbake 16 ../../zconsole/sources/zfontatlas.hpp
+
+The character size must match the one the console selects at its
+default scale, see Zconsole_GetCharacterSize.*/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "../../zconsole/sources/zconsoledefs.hpp"
+#include "../../zconsole/sources/zfontdata.hpp"
+
+#define ZFONTBAKE_ATLASWIDTH  256 //width of the atlas in pixels
+#define ZFONTBAKE_PADDING     2   //empty pixels around every glyph
+
+
+
+/* Section 1:
+** atlas packing
+******************************************************************************/
+struct zbakedglyph {
+	float advance;       //horizontal advance
+	int   left, top;     //offset of the bitmap from the pen
+	int   width, height; //size of the bitmap
+	int   u, v;          //position of the bitmap in the atlas
+};
+
+
+struct zbakedatlas {
+	std::vector<zbakedglyph>   glyphs; //one per console glyph slot
+	std::vector<unsigned char> pixels; //alpha, ZFONTBAKE_ATLASWIDTH wide
+	unsigned int               height; //rows in the atlas
+	float                      spacing;//line spacing
+};
+
+
+static unsigned int 
+Zfontbake_GetCodepoint(
+	unsigned int _index) {
+
+	//same slot order as ZglyphTable: ascii, then box drawing
+	if (_index >= ZCONSOLE_GLYPHASCII) 
+		return _index + ZCONSOLE_GLYPHBOXMIN - ZCONSOLE_GLYPHASCII;
+	return _index;
+}
+
+
+static bool
+Zfontbake_Rasterize(
+	unsigned int _charsize, 
+	zbakedatlas& _atlas) {
+
+	FT_Library library;
+	FT_Face    face;
+
+	if (FT_Init_FreeType(&library) != 0)
+		return false;
+	if (FT_New_Memory_Face(
+			library, 
+			s_zconsole_fontdata, 
+			sizeof(s_zconsole_fontdata), 
+			0, 
+			&face) != 0) {
+		FT_Done_FreeType(library);
+		return false;
+	}
+	FT_Set_Pixel_Sizes(face, 0, _charsize);
+
+	const unsigned int count = 
+		ZCONSOLE_GLYPHASCII + (ZCONSOLE_GLYPHBOXMAX - ZCONSOLE_GLYPHBOXMIN);
+
+	std::vector<std::vector<unsigned char>> bitmaps(count);
+	_atlas.glyphs.assign(count, zbakedglyph());
+	_atlas.spacing = (float)face->size->metrics.height / (float)(1 << 6);
+
+	/*
+	Shelf pack in slot order, the first shelf starts after the 2x2 
+	white block that untextured quads sample at (1, 1):*/
+	unsigned int penx  = 2 + ZFONTBAKE_PADDING;
+	unsigned int peny  = 0;
+	unsigned int shelf = 2;
+
+	for (unsigned int index = 0; index < count; ++index) {
+		zbakedglyph& glyph = _atlas.glyphs[index];
+
+		if (FT_Load_Char(
+				face, 
+				Zfontbake_GetCodepoint(index), 
+				FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) != 0 ||
+			FT_Render_Glyph(face->glyph, FT_RENDER_MODE_NORMAL) != 0) {
+			continue;
+		}
+		const FT_Bitmap& bitmap = face->glyph->bitmap;
+
+		glyph.advance = (float)face->glyph->metrics.horiAdvance / (float)(1 << 6);
+		glyph.left    = face->glyph->bitmap_left;
+		glyph.top     = -face->glyph->bitmap_top;
+		glyph.width   = (int)bitmap.width;
+		glyph.height  = (int)bitmap.rows;
+
+		if (penx + bitmap.width + ZFONTBAKE_PADDING > ZFONTBAKE_ATLASWIDTH) {
+			penx  = 0;
+			peny += shelf + ZFONTBAKE_PADDING;
+			shelf = 0;
+		}
+		glyph.u = (int)penx;
+		glyph.v = (int)peny;
+
+		penx += bitmap.width + ZFONTBAKE_PADDING;
+		if (bitmap.rows > shelf)
+			shelf = bitmap.rows;
+
+		auto& pixels = bitmaps[index];
+		pixels.resize(bitmap.width * bitmap.rows);
+		for (unsigned int y = 0; y < bitmap.rows; ++y) {
+			memcpy(
+				&pixels[y * bitmap.width],
+				bitmap.buffer + (y * bitmap.pitch),
+				bitmap.width);
+		}
+	}
+	_atlas.height = peny + shelf;
+	_atlas.pixels.assign(ZFONTBAKE_ATLASWIDTH * _atlas.height, 0);
+
+	//the white block, same as the pages sf::Font creates
+	_atlas.pixels[0] = _atlas.pixels[1] = 0xFF;
+	_atlas.pixels[ZFONTBAKE_ATLASWIDTH + 0] = 0xFF;
+	_atlas.pixels[ZFONTBAKE_ATLASWIDTH + 1] = 0xFF;
+
+	for (unsigned int index = 0; index < count; ++index) {
+		const zbakedglyph& glyph = _atlas.glyphs[index];
+		for (int y = 0; y < glyph.height; ++y) {
+			memcpy(
+				&_atlas.pixels[(glyph.v + y) * ZFONTBAKE_ATLASWIDTH + glyph.u],
+				&bitmaps[index][y * glyph.width],
+				glyph.width);
+		}
+	}
+	FT_Done_Face(face);
+	FT_Done_FreeType(library);
+	return true;
+}
+
+
+
+
+/* Section 2:
+** header output
+******************************************************************************/
+static void
+Zfontbake_WriteHeader(
+	FILE*              _file,
+	unsigned int       _charsize,
+	const zbakedatlas& _atlas) {
+
+	unsigned int index;
+
+	fprintf(_file, "#pragma once\r\n");
+	fprintf(_file, "//generated by tools/zfontbake from zfontdata.hpp, do not edit\r\n");
+	fprintf(_file, "#define ZFONTATLAS_CHARSIZE    %u\r\n", _charsize);
+	fprintf(_file, "#define ZFONTATLAS_WIDTH       %u\r\n", ZFONTBAKE_ATLASWIDTH);
+	fprintf(_file, "#define ZFONTATLAS_HEIGHT      %u\r\n", _atlas.height);
+	fprintf(_file, "#define ZFONTATLAS_LINESPACING %.6ff\r\n", _atlas.spacing);
+	fprintf(_file, "#define ZFONTATLAS_GLYPHCOUNT  %u\r\n", (unsigned int)_atlas.glyphs.size());
+	fprintf(_file, "\r\n");
+	fprintf(_file, "struct zfontatlasglyph {\r\n");
+	fprintf(_file, "\tfloat advance;       //horizontal advance\r\n");
+	fprintf(_file, "\tint   left, top;     //offset of the bitmap from the pen\r\n");
+	fprintf(_file, "\tint   width, height; //size of the bitmap\r\n");
+	fprintf(_file, "\tint   u, v;          //position of the bitmap in the atlas\r\n");
+	fprintf(_file, "};\r\n");
+	fprintf(_file, "\r\n");
+	fprintf(_file, "static constexpr zfontatlasglyph s_zconsole_atlasglyphs[%u] =\r\n{\r\n", 
+		(unsigned int)_atlas.glyphs.size());
+	for (index = 0; index < _atlas.glyphs.size(); ++index) {
+		const zbakedglyph& glyph = _atlas.glyphs[index];
+		fprintf(_file, 
+			"    { %6.2ff, %3d, %4d, %3d, %3d, %4d, %4d }, // U+%04X\r\n",
+			glyph.advance, 
+			glyph.left, glyph.top, 
+			glyph.width, glyph.height, 
+			glyph.u, glyph.v, 
+			Zfontbake_GetCodepoint(index));
+	}
+	fprintf(_file, "};\r\n\r\n");
+
+	fprintf(_file, "static const unsigned char s_zconsole_atlasdata[%u] =\r\n{\r\n", 
+		(unsigned int)_atlas.pixels.size());
+	fprintf(_file, "//    0    1    2    3    4    5    6    7    8    9   10   11   12   13   14   15\r\n");
+	for (index = 0; index < _atlas.pixels.size(); ++index) {
+		fprintf(_file, 
+			index % 16 == 0 ? "    %3u," : " %3u,", 
+			(unsigned int)_atlas.pixels[index]);
+		if (index % 16 == 15 || index + 1 == _atlas.pixels.size())
+			fprintf(_file, " // %u\r\n", index / 16);
+	}
+	fprintf(_file, "};\r\n");
+}
+
+
+int main(int _argc, char* _argv[]) {
+	zbakedatlas  atlas;
+	unsigned int charsize;
+	FILE*        file;
+
+	if (_argc != 3) {
+		fprintf(stderr, "usage: zfontbake <charsize> <output.hpp>\n");
+		return EXIT_FAILURE;
+	}
+	charsize = (unsigned int)atoi(_argv[1]);
+	if (charsize == 0 || !Zfontbake_Rasterize(charsize, atlas)) {
+		fprintf(stderr, "zfontbake: failed to rasterize the font\n");
+		return EXIT_FAILURE;
+	}
+	file = fopen(_argv[2], "wb");
+	if (!file) {
+		fprintf(stderr, "zfontbake: cannot open %s\n", _argv[2]);
+		return EXIT_FAILURE;
+	}
+	Zfontbake_WriteHeader(file, charsize, atlas);
+	fclose(file);
+	return EXIT_SUCCESS;
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
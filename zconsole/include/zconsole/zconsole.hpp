@@ -1,141 +1,379 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: zconsole.hpp
-* Desc: public interface for console
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/ 
-#ifndef __ZCONSOLE_HPP__
-#define __ZCONSOLE_HPP__
-
-#include "ztypes.h" 
- 
- 
-
-class Zconsole final : sf::NonCopyable {  
-public:
-	static Zconsole* getSingleton() {
-		static Zconsole singleton;
-		return &singleton;
-	}  
-public:
-	/*
-	Initialize the console system. 
-	@_directory: where to load/save a history file
-	@return    : true on success, false otherwise*/
-	bool initialize(const zstring& _directory);
-
-	/*
-	Specifies the directory where Zconsole can load/save history
-	@_directory: where to load/save a history file*/
-	void setDirectory(const zstring& _directory);
-
-	/*
-	Shutdown the console and release resources*/
-	void release();
-
-	/*
-	Register a new command
-	@_command: the command to register
-	@return  : true if command was registered, false on error*/
-	bool insertCommand(const zcommand& _command);
-
-	/*
-	Unregister a command.
-	@_command: the command to unregister
-	@return  : true if command was removed, 
-	           false if the command could not be found or error*/
-	bool removeCommand(const zcommand& _command);
-
-	/*
-	Print a given string to the console screen*/
-	void print(const zstring& _str);
-
-	/*
-	Returns a pointer to the internal font used by the console.
-	(can be used as a default fallback font for example)*/
-	const sf::Font* const getFont() const;
-
-	/*
-	Returns a string containing the current version of Zconsole*/
-	inline zstring getVersion() const { 
-		return "Zconsole [ver 210701]"; 
-	} 
-
-public:
-	/*
-	Activate and open the console window*/
-	void open();
-
-	/*
-	Deactivate and close the console window*/
-	void close();
-
-	/*
-	Process system events- 
-	@_nextevent: the next event in queue*/
-	void onEvent(const sf::Event& _event);
-
-	/*
-	Update the console internal state.
-	@_delta: fixed time step 
-	@return: false when the console is ready to close*/
-	bool onUpdate(float _delta); 
-
-	/*
-	Render contents of the console screen to the given RenderTarget*/
-	void onPresent( 
-	    sf::RenderTarget& _rendertarget,
-	    sf::RenderStates  _renderstates = sf::RenderStates::Default);
-
-private:
-	Zconsole();
-	~Zconsole();
-
-	void pollInput();
-	void processNextCommand();
-	void parseLastLine(bool _isCommandEntry);
-	void scrollHistory(int _direction); 
-
-	class Zscreen;      
-	class Zcursor;      
-	class Zhistory;     
-	class ZcommandTable; 
-	
-	zstring                        m_commandbuffer; 
-	std::unique_ptr<ZcommandTable> m_commandtable;
-	std::unique_ptr<Zcursor>       m_cursor;
-	bool                           m_entrykeyflag;   
-	std::unique_ptr<sf::Font>      m_font;
-	std::unique_ptr<Zhistory>      m_history;
-	bool                           m_isOpenFlag;
-	zstring                        m_lastline;
-    unsigned int                   m_lastlineOffset;
-	zstring                        m_partition;
-	unsigned int                   m_pendingUpdates;
-	float                          m_renderscale; 
-	std::unique_ptr<Zscreen>       m_screen; 
-	unsigned int                   m_textcolor;
-	zvertices                      m_vertices;  
-}; 
-/*****************************************************************************/  
-#endif //EOF
-/*****************************************************************************/  
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zconsole.hpp
+* Desc: public interface for console
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZCONSOLE_HPP__
+#define __ZCONSOLE_HPP__
+
+#include "ztypes.h" 
+ 
+ 
+
+class Zconsole final : sf::NonCopyable {  
+public:
+	static Zconsole* getSingleton() {
+		static Zconsole singleton;
+		return &singleton;
+	}  
+public:
+	/*
+	Initialize the console system. 
+	@_directory: where to load/save a history file
+	@return    : true on success, false otherwise*/
+	bool initialize(const zstring& _directory);
+
+	/*
+	Specifies the directory where Zconsole can load/save history
+	@_directory: where to load/save a history file*/
+	void setDirectory(const zstring& _directory);
+
+	/*
+	Shutdown the console and release resources*/
+	void release();
+
+	/*
+	Register a new command
+	@_command: the command to register
+	@return  : true if command was registered, false on error*/
+	bool insertCommand(const zcommand& _command);
+
+	/*
+	Unregister a command.
+	@_command: the command to unregister
+	@return  : true if command was removed, 
+	           false if the command could not be found or error*/
+	bool removeCommand(const zcommand& _command);
+
+	/*
+	Print a given string to the console screen*/
+	void print(zstrview _str);
+
+	/*
+	Print a formatted line to the console screen. Each {} placeholder 
+	of the format is replaced by the next argument, printed according
+	to its type (see Zconsole_FormatNext for field options). The line 
+	is formatted in a stack buffer of zformat::capacity characters and
+	copied straight into the scrollback, no memory is allocated.
+	@_format: the format text
+	@_args  : the arguments to print*/
+	template <typename... Args>
+	void print(zstrview _format, const Args&... _args);
+
+	/*
+	Print a given string to the console screen from any thread. The 
+	line is queued without locking or waiting and printed by the next
+	onUpdate(). While the queue is full lines are dropped, the drop is
+	counted and reported on the console. 
+	The queue lives as long as the console object, so this may be 
+	called at any time, before initialize() or after release(): lines
+	posted before initialize() are printed by the first onUpdate(), 
+	lines still queued when release() is called are discarded. Only 
+	the destruction of the console, at program exit, must not race a
+	post: producer threads must be joined by then.
+	@_str  : the string to print
+	@return: true if the line was queued, false if it was dropped*/
+	bool post(zstrview _str);
+
+	/*
+	Print a formatted line from any thread, see print() for the format
+	and post() for the queueing. The line is formatted on the calling 
+	thread, in a stack buffer.
+	@_format: the format text
+	@_args  : the arguments to print
+	@return : true if the line was queued, false if it was dropped*/
+	template <typename... Args>
+	bool post(zstrview _format, const Args&... _args);
+
+	/*
+	Returns the number of posted lines dropped because the queue was 
+	full, since the console was created*/
+	unsigned int getDroppedCount() const;
+
+	/*
+	Print a given string from any thread through a buffer owned by the
+	calling thread, for threads logging too often to share the queue. 
+	The first call of a thread registers its buffer, after that a line
+	is a copy into that buffer with no lock or shared counter. Once per
+	onUpdate() the lines of all threads are merged by the time they were
+	logged and printed with the id of their thread, see the thread 
+	command. Thread buffers follow the lifetime rules of post().
+	@_str  : the string to print
+	@return: true if the line was buffered, false if it was dropped*/
+	bool postLocal(zstrview _str);
+
+	/*
+	Print a formatted line from any thread, see print() for the format
+	and postLocal() for the buffering. 
+	@_format: the format text
+	@_args  : the arguments to print
+	@return : true if the line was buffered, false if it was dropped*/
+	template <typename... Args>
+	bool postLocal(zstrview _format, const Args&... _args);
+
+	/*
+	Log a formatted line, a cheaper print for hot paths. The line is
+	not formatted here: the format, registered once and copied, and
+	the raw bytes of the arguments are stored and the text is only
+	produced when the line is drawn, searched or filtered. Arguments 
+	follow the rules of the formatted print, text arguments are copied.
+	A log line takes a single row, text past the console width is cut
+	and line breaks are drawn as spaces.
+	@_format: the format text, a string literal (a pointer does not
+	          compile, the site is found by the address of the text)
+	@_args  : the arguments to print*/
+	template <std::size_t N, typename... Args>
+	void log(const char (&_format)[N], const Args&... _args);
+
+	/*
+	Print several lines to the console screen at once. The lines are 
+	appended back to back and the screen scrolls and redraws once, 
+	so a long report costs about as much as a single print.
+	@_lines: the first line to print
+	@_count: the number of lines to print*/
+	void printLines(const zstring* _lines, unsigned int _count);
+
+	/*
+	Print a list of lines to the console screen at once
+	@_lines: the lines to print*/
+	void printLines(const zstrings& _lines);
+
+	/*
+	Print a multiline text block to the console screen at once,
+	each newline of the block starts a new line.
+	@_block: the text to print*/
+	void printBlock(zstrview _block);
+
+	/*
+	Returns a pointer to the internal font used by the console.
+	(can be used as a default fallback font for example)
+	The console draws from a prebaked atlas by default, so the
+	font is only loaded by the first call to this function.*/
+	const sf::Font* const getFont() const;
+
+	/*
+	Replace the console font with a font file, glyphs are then 
+	rasterized from it instead of using the prebaked atlas. The console
+	is laid out on a grid of cells, so the font must be monospaced: 
+	every printable ascii character has the advance of a space and no
+	kerning.
+	@_filename: path of the font file (ttf, otf...)
+	@return   : true on success, false if the font could not be loaded,
+	            is not monospaced or its glyphs could not be rasterized
+	            (the previous font is then kept)*/
+	bool setFont(const zstring& _filename);
+
+	/*
+	Select the backend used to draw the console.
+	@_mode : the rendering backend
+	@return: true on success, false if the backend is unavailable
+	         (the vertex array backend is used instead)*/
+	bool setRenderMode(zrendermode _mode);
+
+	/*
+	Returns the backend currently used to draw the console*/
+	zrendermode getRenderMode() const;
+
+	/*
+	Enable or disable the render cache. When enabled the console is 
+	drawn into a texture only when its contents change, and each 
+	frame presents that texture as a single quad.
+	@_enable: true to enable the cache, false to disable it*/
+	void setRenderCache(bool _enable);
+
+	/*
+	Returns true if the render cache is enabled and the console image,
+	cursor included, did not change since it was last presented (hosts
+	may then skip their own compositing work)*/
+	bool isRenderCacheValid() const;
+
+	/*
+	Enable or disable the on-disk scrollback tier. Lines that would 
+	otherwise be dropped from the scrollback are appended to a file 
+	and stay reachable by scrolling; only the visible rows are read 
+	back, through a memory mapping of the file.
+	@_filepath: path of the spill file, an empty path disables it
+	@return   : true on success, false if the file could not be created*/
+	bool setScrollbackSpill(const zstring& _filepath);
+
+	/*
+	Set how much memory the scrollback may use. When lines take 
+	more than this, the oldest ones are evicted (or spilled).
+	@_bytes: the retention budget in bytes*/
+	void setScrollbackMaxBytes(unsigned long long _bytes);
+
+	/*
+	Returns the number of bytes of memory held by scrollback lines*/
+	unsigned long long getScrollbackBytes() const;
+
+	/*
+	Returns a string containing the current version of Zconsole*/
+	inline zstring getVersion() const { 
+		return "Zconsole [ver 210701]"; 
+	} 
+
+public:
+	/*
+	Activate and open the console window*/
+	void open();
+
+	/*
+	Deactivate and close the console window*/
+	void close();
+
+	/*
+	Process system events- 
+	@_nextevent: the next event in queue*/
+	void onEvent(const sf::Event& _event);
+
+	/*
+	Update the console internal state.
+	@_delta: fixed time step 
+	@return: false when the console is ready to close*/
+	bool onUpdate(float _delta); 
+
+	/*
+	Render contents of the console screen to the given RenderTarget*/
+	void onPresent( 
+	    sf::RenderTarget& _rendertarget,
+	    sf::RenderStates  _renderstates = sf::RenderStates::Default);
+
+private:
+	Zconsole();
+	~Zconsole();
+
+	void pollInput();
+	void processNextCommand();
+	bool loadFont() const;
+	bool rebuildGlyphs();
+	void updateCharacterSize();
+	float getLayoutScale() const;
+	void rebuildFrame();
+	sf::FloatRect getFrameBounds() const;
+	void rebuildRow(unsigned int _row);
+	float writeGlyph(
+		sf::Vertex*  _quad, 
+		unsigned int _char, 
+		unsigned int _color, 
+		float        _xoffset, 
+		float        _yoffset);
+	void parseLastLine(bool _isCommandEntry);
+	void scrollHistory(int _direction); 
+	void logRecord(
+		zstrview             _format, 
+		zlogdecoder          _decoder, 
+		const unsigned char* _args, 
+		unsigned int         _size);
+
+	class Zscreen;      
+	class Zcursor;      
+	class Zhistory;     
+	class ZcommandTable; 
+	class ZglyphTable;
+	class Zrenderer;
+	class ZvertexArena;
+	class Zscrollback;
+	class ZcoldStore;
+	class Zfilter;
+	class ZspillFile;
+	class ZlogTable;
+	class ZprintQueue;
+	class ZthreadLog;
+	template <typename T> class ZringBuffer;
+	
+	zstring                           m_commandbuffer; 
+	std::unique_ptr<ZcommandTable>    m_commandtable;
+	std::unique_ptr<Zcursor>          m_cursor;
+	zstring                           m_directory;
+	bool                              m_entrykeyflag;   
+	unsigned int                      m_charsize;
+	unsigned int                      m_charsizefailed;
+	mutable std::unique_ptr<sf::Font> m_font;
+	zstring                           m_fontfile;
+	std::unique_ptr<ZglyphTable>      m_glyphtable;
+	std::unique_ptr<Zhistory>         m_history;
+	float                             m_hostscale;
+	bool                              m_isOpenFlag;
+	bool                              m_layoutdirty;
+	zstring                           m_lastline;
+	unsigned int                      m_lastlineOffset;
+	std::unique_ptr<ZlogTable>        m_logtable;
+	zstring                           m_partition;
+	unsigned int                      m_pendingUpdates;
+	std::unique_ptr<ZprintQueue>      m_printqueue;
+	std::unique_ptr<Zrenderer>        m_renderer;
+	float                             m_renderscale; 
+	std::unique_ptr<Zscreen>          m_screen; 
+	unsigned int                      m_textcolor;
+	std::unique_ptr<ZthreadLog>       m_threadlog;
+	std::unique_ptr<ZvertexArena>     m_vertices;  
+}; 
+
+
+
+template <typename... Args>
+void Zconsole::print(zstrview _format, const Args&... _args) {
+	zformat line;
+	Zconsole_FormatLine(line, _format, _args...);
+	print(zstrview(line.text, line.size));
+}
+
+
+template <typename... Args>
+bool Zconsole::post(zstrview _format, const Args&... _args) {
+	zformat line;
+	Zconsole_FormatLine(line, _format, _args...);
+	return post(zstrview(line.text, line.size));
+}
+
+
+template <typename... Args>
+bool Zconsole::postLocal(zstrview _format, const Args&... _args) {
+	zformat line;
+	Zconsole_FormatLine(line, _format, _args...);
+	return postLocal(zstrview(line.text, line.size));
+}
+
+
+template <std::size_t N, typename... Args>
+void Zconsole::log(const char (&_format)[N], const Args&... _args) {
+	//text arguments share what the fixed size arguments leave
+	constexpr std::size_t fixed = 
+		(std::size_t(0) + ... + Zconsole_LogFixedSize<Args>());
+	static_assert(fixed <= zformat::capacity, "too many arguments to log");
+
+	unsigned char  args[zformat::capacity];
+	unsigned char* cursor = args;
+	std::size_t    room   = zformat::capacity - fixed;
+	(Zconsole_LogWrite(cursor, room, _args), ...);
+
+	//a literal is measured at compile time, an array up to its end
+	logRecord(
+		zstrview(_format, std::char_traits<char>::length(_format)), 
+		&Zconsole_LogDecode<Args...>, 
+		args, 
+		(unsigned int)(cursor - args));
+}
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -1,72 +1,356 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: ztypes.hpp
-* Desc: basic type definitions used by zconsole
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/ 
-#ifndef __ZTYPES_HPP__
-#define __ZTYPES_HPP__
-
-#include <vector>
-#include <string>
-#include <memory>  
-#include <functional>
-#include <sfml/system.hpp>
-#include <sfml/window.hpp>
-#include <sfml/graphics.hpp>
-
-
-
-using zstring   = std::string;
-using zstrings  = std::vector<std::string>; 
-using zustring  = std::basic_string<unsigned>;
-using zvertices = std::vector<sf::Vertex>;
-
-/* 
-An std::function<> based console callback, which is templated on a
-function signature and accepts a string vector containing arguments.*/
-using zcallback = std::function<void(zstrings _args)>;
-
-/*
-A structure for storing a callback function and information*/
-struct zcommand { 
-    zcallback func; //command callback function 
-	zstring   name; //name of command name (as entered)
-	zstring   emsg; //optional message to print on return
-	zstrings  help; //description and help information 
-}; 
-
-/*
-Helper Function for use with Zconsole commands:
-Converts a given argument into an equivalent boolean value.
-@_arg  : the argument to convert
-@return:  (0)- argument equates to false
-          (1)- argument equates to true
-		 (-1)- argument did not equate to a boolean value*/
-extern int 
-Zconsole_ArgToBool(
-	const zstring& _arg);
-
-
-/*****************************************************************************/  
-#endif //EOF
-/*****************************************************************************/  
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: ztypes.hpp
+* Desc: basic type definitions used by zconsole
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZTYPES_HPP__
+#define __ZTYPES_HPP__
+
+#include <vector>
+#include <string>
+#include <memory>  
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <sfml/system.hpp>
+#include <sfml/window.hpp>
+#include <sfml/graphics.hpp>
+
+
+
+using zstring   = std::string;
+using zstrings  = std::vector<std::string>; 
+using zstrview  = std::string_view;
+using zustring  = std::basic_string<unsigned>;
+using zvertices = std::vector<sf::Vertex>;
+
+/* 
+An std::function<> based console callback, which is templated on a
+function signature and accepts a string vector containing arguments.*/
+using zcallback = std::function<void(zstrings _args)>;
+
+/*
+A structure for storing a callback function and information*/
+struct zcommand { 
+    zcallback func; //command callback function 
+	zstring   name; //name of command name (as entered)
+	zstring   emsg; //optional message to print on return
+	zstrings  help; //description and help information 
+}; 
+
+/*
+Backends available for drawing the console*/
+enum zrendermode {
+	ZRENDER_VERTEXARRAY  = 0, //client side vertex array, sent every frame
+	ZRENDER_VERTEXBUFFER = 1, //gpu resident vertex buffer, partial updates
+	ZRENDER_CELLGRID     = 2, //single quad, cells drawn by a shader
+};
+
+/*
+Helper Function for use with Zconsole commands:
+Converts a given argument into an equivalent boolean value.
+@_arg  : the argument to convert
+@return:  (0)- argument equates to false
+          (1)- argument equates to true
+		 (-1)- argument did not equate to a boolean value*/
+extern int 
+Zconsole_ArgToBool(
+	const zstring& _arg);
+
+/*
+Helper Function for hosts drawing their own geometry:
+Computes the axis aligned bounding box of an array of vertices.
+Positions are reduced several at a time with SIMD min/max where
+the target supports it, with a branchless scalar loop otherwise.
+@_vertices: first vertex of the array
+@_count   : number of vertices in the array
+@return   : the bounding box, empty if _count is zero*/
+extern sf::FloatRect
+Zconsole_GetVerticesBounds(
+	const sf::Vertex* _vertices,
+	std::size_t       _count);
+
+/*
+A fixed size line buffer for formatted printing. It is meant to live
+on the stack, text past its capacity is dropped rather than growing
+the buffer, so formatting a line never allocates.*/
+struct zformat {
+	static constexpr std::size_t capacity = 256;
+
+	char         text[capacity]; //formatted text, not null terminated
+	std::size_t  size;           //number of characters written
+	unsigned int width;          //minimum width of the current field
+	int          precision;      //decimals of the current field, or -1
+	char         fill;           //padding character of the current field
+	char         type;           //'x' or 'X' for hexadecimal, 0 otherwise
+};
+
+/*
+Helper Function for formatted printing:
+Copies the format text up to the next {} placeholder into the line 
+and reads the field options of the placeholder. Placeholders accept 
+an optional width, zero padding, a number of decimals and hexadecimal
+output, as in {:8}, {:02X}, {:.2} or {:x}. A doubled brace prints a 
+single brace.
+@_line  : the line being formatted
+@_format: the remaining format text, advanced past the placeholder
+@return : true if a placeholder was found, 
+          false if the rest of the format was copied*/
+extern bool
+Zconsole_FormatNext(
+	zformat&  _line,
+	zstrview& _format);
+
+/*
+Helper Function for formatted printing:
+Appends text to the line, left aligned within the field width.
+@_line: the line being formatted
+@_text: the text to append*/
+extern void
+Zconsole_FormatText(
+	zformat& _line,
+	zstrview _text);
+
+/*
+Helper Function for formatted printing:
+Appends an integer to the line, right aligned within the field width.
+@_line     : the line being formatted
+@_magnitude: the absolute value of the integer
+@_negative : true if the integer is negative*/
+extern void
+Zconsole_FormatInteger(
+	zformat&           _line,
+	unsigned long long _magnitude,
+	bool               _negative);
+
+/*
+Helper Function for formatted printing:
+Appends a floating point value to the line, right aligned within 
+the field width. Values print with the field decimals when given,
+with the shortest of fixed or scientific notation otherwise.
+@_line : the line being formatted
+@_value: the value to append*/
+extern void
+Zconsole_FormatFloat(
+	zformat& _line,
+	double   _value);
+
+/*
+Helper Function for formatted printing:
+Appends one argument to the line, choosing how to print it from its
+type. Arguments that cannot be printed fail to compile.
+@_line : the line being formatted
+@_value: the argument to append*/
+template <typename T>
+inline void 
+Zconsole_FormatValue(
+	zformat& _line, 
+	const T& _value) {
+
+	if constexpr (std::is_same<T, bool>::value) {
+		Zconsole_FormatText(_line, _value ? "true" : "false");
+	}
+	else if constexpr (std::is_same<T, char>::value) {
+		Zconsole_FormatText(_line, zstrview(&_value, 1));
+	}
+	else if constexpr (std::is_integral<T>::value) {
+		if constexpr (std::is_signed<T>::value) {
+			const long long value = _value;
+			Zconsole_FormatInteger(_line, 
+				value < 0 ? 0ull - (unsigned long long)value : value, 
+				value < 0);
+		}
+		else Zconsole_FormatInteger(_line, _value, false);
+	}
+	else if constexpr (std::is_enum<T>::value) {
+		using U = typename std::underlying_type<T>::type;
+		Zconsole_FormatValue(_line, (U)_value);
+	}
+	else if constexpr (std::is_floating_point<T>::value) {
+		Zconsole_FormatFloat(_line, (double)_value);
+	}
+	else if constexpr (std::is_convertible<const T&, zstrview>::value) {
+		if constexpr (std::is_pointer<T>::value) {
+			if (!_value) {
+				Zconsole_FormatText(_line, "(null)");
+				return;
+			}
+		}
+		Zconsole_FormatText(_line, zstrview(_value));
+	}
+	else if constexpr (std::is_pointer<T>::value) {
+		if (_line.type == 0)
+			_line.type = 'X';
+		Zconsole_FormatInteger(_line, (unsigned long long)_value, false);
+	}
+	else static_assert(!sizeof(T), "argument type cannot be printed");
+}
+
+
+/*
+Helper Function for formatted printing:
+Formats a line into a zformat buffer, each {} placeholder of the 
+format is replaced by the next argument. Placeholders left without
+an argument print nothing, extra arguments are ignored.
+@_line  : receives the formatted line
+@_format: the format text
+@_args  : the arguments to print*/
+template <typename... Args>
+inline void 
+Zconsole_FormatLine(
+	zformat&        _line, 
+	zstrview        _format, 
+	const Args&...  _args) {
+
+	_line.size = 0;
+	auto field = [&](const auto& _arg) {
+		if (Zconsole_FormatNext(_line, _format))
+			Zconsole_FormatValue(_line, _arg);
+	};
+	(field(_args), ...);
+	while (Zconsole_FormatNext(_line, _format)) {}
+}
+
+
+/*
+Decodes the arguments of a deferred log line and formats the line,
+one function is generated for each list of argument types.*/
+using zlogdecoder = void(*)(
+	zformat&             _line, 
+	zstrview             _format, 
+	const unsigned char* _args);
+
+/*
+Helper Function for deferred logging:
+Returns true if an argument is logged as text, the text is copied 
+since the argument may not outlive the log call.*/
+template <typename T>
+constexpr bool 
+Zconsole_LogIsText() {
+	return std::is_convertible<const T&, zstrview>::value;
+}
+
+/*
+Helper Function for deferred logging:
+Returns the number of bytes an argument takes in a log record, text 
+arguments take a length here and their characters on top of it.*/
+template <typename T>
+constexpr std::size_t 
+Zconsole_LogFixedSize() {
+	return Zconsole_LogIsText<T>() ? sizeof(unsigned int) : sizeof(T);
+}
+
+/*
+Helper Function for deferred logging:
+Appends the raw bytes of an argument to a log record. Text is cut 
+to the room left for text in the record.
+@_cursor: where to write, advanced past the argument
+@_room  : the number of text bytes left in the record
+@_value : the argument*/
+template <typename T>
+inline void 
+Zconsole_LogWrite(
+	unsigned char*& _cursor, 
+	std::size_t&    _room, 
+	const T&        _value) {
+
+	if constexpr (Zconsole_LogIsText<T>()) {
+		zstrview text;
+		if constexpr (std::is_pointer<T>::value) {
+			if (_value)
+				text = _value;
+		}
+		else text = _value;
+
+		const unsigned int size = 
+			(unsigned int)(text.size() < _room ? text.size() : _room);
+		memcpy(_cursor, &size, sizeof(size));
+		memcpy(_cursor + sizeof(size), text.data(), size);
+		_cursor += sizeof(size) + size;
+		_room   -= size;
+	}
+	else {
+		static_assert(std::is_trivially_copyable<T>::value, 
+			"argument type cannot be logged");
+		memcpy(_cursor, &_value, sizeof(T));
+		_cursor += sizeof(T);
+	}
+}
+
+/*
+Helper Function for deferred logging:
+Reads the raw bytes of an argument back and formats it into the line.
+@_line  : the line being formatted
+@_format: the remaining format text
+@_cursor: where to read, advanced past the argument*/
+template <typename T>
+inline void 
+Zconsole_LogRead(
+	zformat&              _line, 
+	zstrview&             _format, 
+	const unsigned char*& _cursor) {
+
+	if constexpr (Zconsole_LogIsText<T>()) {
+		unsigned int size;
+		memcpy(&size, _cursor, sizeof(size));
+		const zstrview text(
+			reinterpret_cast<const char*>(_cursor + sizeof(size)), size);
+		_cursor += sizeof(size) + size;
+
+		if (Zconsole_FormatNext(_line, _format))
+			Zconsole_FormatText(_line, text);
+	}
+	else {
+		T value;
+		memcpy(&value, _cursor, sizeof(T));
+		_cursor += sizeof(T);
+
+		if (Zconsole_FormatNext(_line, _format))
+			Zconsole_FormatValue(_line, value);
+	}
+}
+
+/*
+Helper Function for deferred logging:
+Formats a log line from its format and the raw bytes of its arguments,
+the address of an instance is a zlogdecoder.
+@_line  : receives the formatted line
+@_format: the format text
+@_args  : the raw bytes of the arguments*/
+template <typename... Args>
+void 
+Zconsole_LogDecode(
+	zformat&             _line, 
+	zstrview             _format, 
+	const unsigned char* _args) {
+
+	_line.size = 0;
+	(Zconsole_LogRead<Args>(_line, _format, _args), ...);
+	while (Zconsole_FormatNext(_line, _format)) {}
+}
+
+
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
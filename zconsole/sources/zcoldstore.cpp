@@ -0,0 +1,327 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zcoldstore.cpp
+* Desc: block compressed tier for console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#include <cstring>
+#include "zconsoledefs.hpp"
+#include "zhelperfuncs.hpp"
+#include "zcoldstore.hpp"
+
+
+
+/* Section 1:
+** internal interface functions
+******************************************************************************/
+void Zconsole::ZcoldStore::compressStaging() {
+	const unsigned int rawsize = m_staging.size();
+
+	m_scratch.resize(Zconsole_CompressBound(rawsize));
+	const unsigned int size = 
+		Zconsole_CompressBlock(m_staging.data(), rawsize, m_scratch.data());
+
+	Block block;
+	block.data.reset(new unsigned char[size]);
+	block.size    = size;
+	block.rawsize = rawsize;
+	block.serial  = m_nextserial++;
+	block.lines.assign(m_staginglines.begin(), m_staginglines.end());
+	memcpy(block.data.get(), m_scratch.data(), size);
+
+	m_blockraw   += rawsize;
+	m_blockbytes += size;
+	m_indexbytes += block.lines.size() * sizeof(Entry);
+	m_blocks.push_back(std::move(block));
+
+	//the staging buffers keep their capacity for the next block
+	m_staging.clear();
+	m_staginglines.clear();
+}
+
+
+const unsigned char* 
+Zconsole::ZcoldStore::getBlockData(const Block& _block) {
+	CacheSlot* slot = &m_cache[0];
+	for (auto& it : m_cache) {
+		if (it.valid && it.serial == _block.serial) {
+			it.lastuse = ++m_clock;
+			return it.data.data();
+		}
+		//reuse an empty slot, else the least recently used one
+		if (!it.valid || (slot->valid && it.lastuse < slot->lastuse))
+			slot = &it;
+	}
+	slot->data.resize(_block.rawsize);
+	slot->valid = Zconsole_DecompressBlock(
+		_block.data.get(), 
+		_block.size, 
+		slot->data.data(), 
+		_block.rawsize);
+	if (!slot->valid)
+		return nullptr;
+
+	slot->serial  = _block.serial;
+	slot->lastuse = ++m_clock;
+	return slot->data.data();
+}
+
+
+const Zconsole::ZcoldStore::Entry* 
+Zconsole::ZcoldStore::findEntry(
+	const std::vector<Entry>& _lines, 
+	unsigned int              _row,
+	unsigned int&             _hint) {
+
+	const unsigned int base  = _lines.front().first;
+	const unsigned int row   = _row - base;
+	const unsigned int count = _lines.size();
+
+	//lines are mostly looked up in order, try around the last one first
+	unsigned int lo = 0;
+	unsigned int hi = count;
+	for (unsigned int i = 0; i < 3; ++i) {
+		const unsigned int hint = _hint + i - 1;
+		if (hint < count && 
+			_lines[hint].first - base <= row &&
+			(hint + 1 == count || _lines[hint + 1].first - base > row)) {
+			lo = hi = hint;
+			break;
+		}
+	}
+	while (hi - lo > 1) {
+		const unsigned int mid = lo + (hi - lo) / 2;
+		if (_lines[mid].first - base <= row)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	_hint = lo;
+	return &_lines[lo];
+}
+
+
+
+
+
+/* Section 2:
+** public interface functions
+******************************************************************************/
+Zconsole::ZcoldStore::ZcoldStore(
+	unsigned int _blocksize, 
+	unsigned int _cachesize) :
+	m_cache(std::max(_cachesize, 1u)),
+	m_blocksize(_blocksize),
+	m_nextserial(0),
+	m_clock(0),
+	m_lastblock(0),
+	m_lastline(0),
+	m_linecount(0),
+	m_rawbytes(0),
+	m_blockraw(0),
+	m_blockbytes(0),
+	m_indexbytes(0) {
+
+	for (auto& it : m_cache) {
+		it.serial  = 0;
+		it.lastuse = 0;
+		it.valid   = false;
+	}
+	m_staging.reserve(_blocksize);
+}
+
+
+void Zconsole::ZcoldStore::append(
+	const void*  _record, 
+	unsigned int _bytes, 
+	unsigned int _first) {
+
+	Entry entry;
+	entry.offset = m_staging.size();
+	entry.bytes  = _bytes;
+	entry.first  = _first;
+
+	const unsigned char* bytes = static_cast<const unsigned char*>(_record);
+	m_staging.insert(m_staging.end(), bytes, bytes + _bytes);
+	m_staginglines.push_back(entry);
+
+	++m_linecount;
+	m_rawbytes += _bytes;
+
+	if (m_staging.size() >= m_blocksize)
+		compressStaging();
+}
+
+
+void Zconsole::ZcoldStore::popBlock(ZspillFile& _spill) {
+	if (m_blocks.empty()) {
+		if (m_staginglines.empty())
+			return;
+		//staged lines are not compressed yet, they go one at a time
+		const Entry entry = m_staginglines.front();
+		if (_spill.isOpen())
+			_spill.append(&m_staging[entry.offset], entry.bytes, entry.first);
+
+		m_staging.erase(m_staging.begin(), m_staging.begin() + entry.bytes);
+		m_staginglines.erase(m_staginglines.begin());
+		for (auto& it : m_staginglines)
+			it.offset -= entry.bytes;
+
+		--m_linecount;
+		m_rawbytes -= entry.bytes;
+		return;
+	}
+	const Block& block = m_blocks.front();
+
+	if (_spill.isOpen()) {
+		const unsigned char* data = getBlockData(block);
+		for (const auto& it : block.lines) {
+			if (!data || !_spill.isOpen())
+				break;
+			_spill.append(data + it.offset, it.bytes, it.first);
+		}
+	}
+	for (auto& it : m_cache) {
+		if (it.serial == block.serial)
+			it.valid = false;
+	}
+	m_linecount  -= block.lines.size();
+	m_rawbytes   -= block.rawsize;
+	m_blockraw   -= block.rawsize;
+	m_blockbytes -= block.size;
+	m_indexbytes -= block.lines.size() * sizeof(Entry);
+	m_blocks.pop_front();
+}
+
+
+const unsigned char* Zconsole::ZcoldStore::find(
+	unsigned int  _row, 
+	unsigned int& _first) {
+
+	if (m_linecount == 0)
+		return nullptr;
+
+	//the staged lines are the newest ones
+	const unsigned int base = getFirstRow();
+	if (!m_staginglines.empty() && 
+		_row - base >= m_staginglines.front().first - base) {
+		const Entry* entry = findEntry(m_staginglines, _row, m_lastline);
+		_first = entry->first;
+		return &m_staging[entry->offset];
+	}
+
+	const unsigned int row   = _row - base;
+	const unsigned int count = m_blocks.size();
+
+	unsigned int lo = 0;
+	unsigned int hi = count;
+	if (m_lastblock < count && 
+		m_blocks[m_lastblock].lines.front().first - base <= row &&
+		m_blocks[m_lastblock].lines.back().first - base >= row)
+		lo = hi = m_lastblock;
+	while (hi - lo > 1) {
+		const unsigned int mid = lo + (hi - lo) / 2;
+		if (m_blocks[mid].lines.front().first - base <= row)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	const Block&         block = m_blocks[lo];
+	const unsigned char* data  = getBlockData(block);
+	if (!data)
+		return nullptr;
+
+	m_lastblock = lo;
+
+	const Entry* entry = findEntry(block.lines, _row, m_lastline);
+	_first = entry->first;
+	return data + entry->offset;
+}
+
+
+void Zconsole::ZcoldStore::clear() {
+	m_blocks.clear();
+	m_staging.clear();
+	m_staginglines.clear();
+	for (auto& it : m_cache) 
+		it.valid = false;
+
+	m_linecount  = 0;
+	m_rawbytes   = 0;
+	m_blockraw   = 0;
+	m_blockbytes = 0;
+	m_indexbytes = 0;
+}
+
+
+bool Zconsole::ZcoldStore::empty() const {
+	return m_linecount == 0;
+}
+
+
+unsigned int Zconsole::ZcoldStore::getFirstRow() const {
+	if (!m_blocks.empty())
+		return m_blocks.front().lines.front().first;
+	if (!m_staginglines.empty())
+		return m_staginglines.front().first;
+	return 0;
+}
+
+
+unsigned int Zconsole::ZcoldStore::getLineCount() const {
+	return m_linecount;
+}
+
+
+unsigned int Zconsole::ZcoldStore::getBlockCount() const {
+	return m_blocks.size();
+}
+
+
+unsigned long long Zconsole::ZcoldStore::getRawBytes() const {
+	return m_rawbytes;
+}
+
+
+unsigned long long Zconsole::ZcoldStore::getStoredBytes() const {
+	return 
+		m_blockbytes + m_indexbytes + 
+		m_staging.size() + m_staginglines.size() * sizeof(Entry);
+}
+
+
+unsigned long long Zconsole::ZcoldStore::getResidentBytes() const {
+	unsigned long long bytes = getStoredBytes();
+	for (const auto& it : m_cache) 
+		bytes += it.data.capacity();
+	return bytes;
+}
+
+
+float Zconsole::ZcoldStore::getRatio() const {
+	if (m_blockbytes == 0)
+		return 1.f;
+	return (float)((double)m_blockraw / (double)m_blockbytes);
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
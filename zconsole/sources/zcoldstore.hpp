@@ -0,0 +1,153 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zcoldstore.hpp
+* Desc: block compressed tier for console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#ifndef __ZCOLDSTORE_HPP__
+#define __ZCOLDSTORE_HPP__
+
+#include <deque>
+#include "zspillfile.hpp"
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::ZcoldStore final  {
+public: 
+	ZcoldStore(unsigned int _blocksize, unsigned int _cachesize);
+	~ZcoldStore() {}	
+
+	/*
+	Append a scrollback record. Records are staged uncompressed
+	until a block is full, the whole block is then compressed.
+	@_record: the record, as stored in the scrollback arena
+	@_bytes : size of the record
+	@_first : row number of the first row of the line*/
+	void append(const void* _record, unsigned int _bytes, unsigned int _first);
+
+	/*
+	Remove the oldest block, or the oldest staged line when no block
+	is left: a compressed block only goes whole, staged lines go one
+	at a time. Removed lines are appended to the spill file if it is
+	open.
+	@_spill: the on-disk tier*/
+	void popBlock(ZspillFile& _spill);
+
+	/*
+	Find the line holding a row and return its record. The block
+	is decompressed unless it is one of the last few used blocks.
+	The pointer is valid until the next call.
+	@_row  : the row number to look for
+	@_first: receives the row number of the first row of the line
+	@return: the record, or nullptr if the block could not be read*/
+	const unsigned char* find(unsigned int _row, unsigned int& _first);
+
+	/*
+	Remove every line and block*/
+	void clear();
+
+	/*
+	Returns true if no line is held*/
+	bool empty() const;
+
+	/*
+	Returns the row number of the oldest row held*/
+	unsigned int getFirstRow() const;
+
+	/*
+	Returns the number of lines held*/
+	unsigned int getLineCount() const;
+
+	/*
+	Returns the number of compressed blocks*/
+	unsigned int getBlockCount() const;
+
+	/*
+	Returns the uncompressed size of the lines held*/
+	unsigned long long getRawBytes() const;
+
+	/*
+	Returns the size of the lines once stored: compressed blocks,
+	their line index and the staged lines*/
+	unsigned long long getStoredBytes() const;
+
+	/*
+	Returns the stored bytes plus the decompressed blocks cached*/
+	unsigned long long getResidentBytes() const;
+
+	/*
+	Returns the uncompressed to compressed size ratio of the blocks*/
+	float getRatio() const;
+
+private:
+	/*
+	Line index entry, offsets are within the decompressed block*/
+	struct Entry {
+		unsigned int offset; //offset of the record
+		unsigned int bytes;  //size of the record
+		unsigned int first;  //row number of the first row
+	};
+	/*
+	A group of lines compressed together*/
+	struct Block {
+		std::unique_ptr<unsigned char[]> data;    //compressed records
+		unsigned int                     size;    //compressed size
+		unsigned int                     rawsize; //decompressed size
+		unsigned int                     serial;  //block number, for the cache
+		std::vector<Entry>               lines;   //line index, oldest first
+	};
+	/*
+	A decompressed block*/
+	struct CacheSlot {
+		std::vector<unsigned char> data;    //decompressed records
+		unsigned int               serial;  //block number held
+		unsigned int               lastuse; //clock of the last lookup
+		bool                       valid;   //true if data holds a block
+	};
+
+	void compressStaging();
+	const unsigned char* getBlockData(const Block& _block);
+	static const Entry* findEntry(
+		const std::vector<Entry>& _lines, 
+		unsigned int              _row,
+		unsigned int&             _hint);
+
+	std::deque<Block>          m_blocks;      //compressed blocks, oldest first
+	std::vector<unsigned char> m_staging;     //records of the block being filled
+	std::vector<Entry>         m_staginglines;//line index of the staged records
+	std::vector<CacheSlot>     m_cache;       //last decompressed blocks
+	std::vector<unsigned char> m_scratch;     //compression output
+	unsigned int               m_blocksize;   //raw bytes per block
+	unsigned int               m_nextserial;  //serial of the next block
+	unsigned int               m_clock;       //cache lookup counter
+	unsigned int               m_lastblock;   //index of the block last looked up
+	unsigned int               m_lastline;    //index of the line last looked up
+	unsigned int               m_linecount;   //number of lines held
+	unsigned long long         m_rawbytes;    //raw size of every line held
+	unsigned long long         m_blockraw;    //raw size of the blocks
+	unsigned long long         m_blockbytes;  //compressed size of the blocks
+	unsigned long long         m_indexbytes;  //size of the block line indices
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -1,411 +1,680 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: zcommandtable.cpp
-* Desc: interface for console commands
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/  
-#include "zhelperfuncs.hpp"  
-#include "zhistory.hpp"
-#include "zconsoledefs.hpp"
-#include "zscreen.hpp"
-#include "zcommandtable.hpp" 
-
-
-
- 
-
-/* Section 1:
-** Initialization and Command parsing*/
-//***************************************************************************//
-void Zconsole::ZcommandTable::initHelpTextTable(
-	std::map<zstring, zstrings>& _table) const {  
-	
-#define CMD_NO_ARGS \
-      "If no argument is given, command will be ignored",\
-      "or will display the current configuration."
-
-#define VALID_BOOL_ARGS "", \
-      "1 		 0      ",  \
-      "on 	     off    ",  \
-      "set       unset  ",  \
-      "true	     false  ",  \
-      "enable    disable",  \
-      CMD_NO_ARGS,       "" 
-	 
-	_table["cls"] = {
-		"clears the console screen.",
-		"Example: \"cls\"",
-	};
-	_table["color"] = {
-		"sets the default console text color.",
-		"color [attr] - (attr) specifies color identified by a hex digit",
-		"                      digit can be any of the following values:",
-		"",
-		"0 = Green     6 = Cyan		",
-		"1 = Brown     7 = Magenta  ",
-		"2 = Amber     8 = Lt Green ",
-		"3 = Grey      9 = Blue 	",
-		"4 = Red       A = White    ",
-		"5 = Purple                 ",
-		"",
-		CMD_NO_ARGS,
-		"Example: \"color 0\" produces green text",
-	};  
-	_table["delhistory"] = {
-	   "clears the command history.",
-	   "Example: \"delhistory\"",
-	};
-	_table["echo"] = {
-		"displays messages, or turns command-echoing on or off.",
-		"",
-		"echo [on | off]",
-		"echo [message]",
-		"",
-		"Or type \"echo\" w/o parameters to display current echo setting.",
-	};
-	_table["exit"] = {
-		"quits the command interpretor",
-		"example: \"exit\"",
-	}; 
-	_table["help"] = {
-		"provides help information for console commands.",
-		"help [command] - (command) displays help information on command.",
-		"",
-		"example: \"help color\"",
-	};
-	_table["loadhistory"] = {
-		"loads previously saved command history from disk",
-		"example: \"loadhistory\"",
-	};
-	_table["palette"] = {
-		"demonstrates the palette by printing in each color.",
-		"example: \"palette\"",
-	};
-	_table["savehistory"] = {
-		"saves the command history to a text file on diskr",
-		"example: \"savehistory\"",
-	}; 
-	_table["scale"] = {
-	    "define the scale factor the console is rendered at.",
-	    "example: \"scale\"",
-	};
-	_table["showhistory"] = {
-		"displays command history",
-		"example: \"showhistory\"",
-	};   
-	_table["loadstate"] = {
-		"load a state into memory.", 
-		CMD_NO_ARGS,
-		"Example: \"loadstate test\" loads the test program into memory",
-	};
-	_table["ver"] = {
-	   "displays the console version",
-	   "example: \"ver\"",
-	}; 
-#undef CMD_NO_ARGS
-#undef VALID_BOOL_ARGS 
-} 
-
-
-void Zconsole::ZcommandTable::initialize() { 
-	std::vector<zcommand> commandlist;
-	{
-		zcommand command;
-	    #define BIND(x)\
-            std::bind(&ZcommandTable::x, this, std::placeholders::_1)  
-
-		command.name = "cls";
-		command.func = BIND(cmd_cls);
-		commandlist.push_back(command);
-
-		command.name = "color";
-		command.func = BIND(cmd_color);
-		commandlist.push_back(command);
-
-		command.name = "delhistory";
-		command.func = BIND(cmd_delhistory);
-		commandlist.push_back(command);
-
-		command.name = "echo";
-		command.func = BIND(cmd_echo);
-		commandlist.push_back(command);
-
-		command.name = "exit";
-		command.func = BIND(cmd_exit);
-		commandlist.push_back(command);
-
-		command.name = "help";
-		command.func = BIND(cmd_help);
-		commandlist.push_back(command);
-
-		command.name = "loadhistory";
-		command.func = BIND(cmd_loadhistory);
-		commandlist.push_back(command);		
-
-		command.name = "palette";
-		command.func = BIND(cmd_palette);
-		commandlist.push_back(command);
-
-		command.name = "savehistory";
-		command.func = BIND(cmd_savehistory);
-		commandlist.push_back(command);
-
-		command.name = "scale";
-		command.func = BIND(cmd_scale);
-		commandlist.push_back(command); 
-
-		command.name = "showhistory";
-		command.func = BIND(cmd_showhistory);
-		commandlist.push_back(command); 
-
-		command.name = "ver";
-		command.func = BIND(cmd_ver);
-		commandlist.push_back(command);
-	#undef BIND
-	}
-	m_commandmap.clear(); 
-	
-	std::map<zstring, zstrings> helptext;
-	initHelpTextTable(helptext);
-
-	for (auto& it : commandlist) {
-		auto help = helptext.find(it.name);
-		if (help != helptext.end())
-			it.help = help->second;
-
-		if (!insert(it)) { 
-			return;
-		}
-	}  
-} 
-
-
-bool Zconsole::ZcommandTable::insert(const zcommand& _command) {  
-	auto entry = m_commandmap.find(_command.name);
-	if (entry == m_commandmap.end()) {
-		m_commandmap.insert(std::make_pair(_command.name, _command));
-		if (m_longestcmd.length() < _command.name.length()) 
-			m_longestcmd = _command.name; 
-		return true;
-	}
-	return false; 
-}
-
-
-bool Zconsole::ZcommandTable::remove(const zcommand& _command) {
-	auto entry = m_commandmap.find(_command.name);
-	if (entry != m_commandmap.end()) {
-		m_commandmap.erase(_command.name);
-		return true;
-	}
-	return false;
-}
-
-
-void Zconsole::ZcommandTable::run(zstrings& _args) {
-	static zstring lastcommand;
-	lastcommand = "";
-
-	const auto it = m_commandmap.find(_args[0]);
-	if (it != m_commandmap.end()) {
-		/*
-		Remove command name and empty args:*/
-		_args.erase(_args.begin());
-		for (auto it = _args.begin(); it != _args.end();) {
-			if (!it->empty()) ++it;
-			else it = _args.erase(it);
-		}
-		//lowercase:
-		for (auto& it : _args) {
-			it = Zconsole_StringToLower(it);
-		}
-		lastcommand = it->second.name;
-		it->second.func(_args);
-	}
-	else {
-		m_lpconsole->print("unknown command: " + _args[0]);
-	}
-	m_lpconsole->print(" ");
-} 
-
-
- 
-
-
-/* Section 2:
-** Command function definitions*/
-//***************************************************************************//
-void Zconsole::ZcommandTable::cmd_cls(zstrings _args) {
-	m_lpconsole->m_screen->clear();
-	m_lpconsole->print("console screen cleared"); 
-} 
- 
-
-void Zconsole::ZcommandTable::cmd_color(zstrings _args) {
-	unsigned int rgba = m_lpconsole->m_textcolor; //rgba color code
-	zstring      cstr = "";                       //color string 
-	 
-	if (_args.empty()) { 
-		Zconsole_GetColorCodes(rgba, rgba, cstr);
-		m_lpconsole->print("console font color is set to: " + cstr);
-		return;
-	} 
-	rgba = Zconsole_HexStringToUint(_args[0].c_str());
-	if (rgba > 0xA) 
-		m_lpconsole->print("invalid command arguments"); 
-	else {
-		Zconsole_GetColorCodes(rgba, rgba, cstr);
-		m_lpconsole->m_textcolor = rgba;
-		m_lpconsole->print("console font color was set to: " + cstr);
-	}
-} 
- 
-
-void Zconsole::ZcommandTable::cmd_delhistory(zstrings _args) { 
-	m_lpconsole->m_history->clear();
-} 
- 
-
-void Zconsole::ZcommandTable::cmd_echo(zstrings _args) {  
-	if (!_args.empty() && !_args[0].empty()) 
-		m_lpconsole->print(_args[0]); 
-	else m_lpconsole->print("echo is enabled"); 
-	m_lpconsole->print(" ");
-}
- 
-
-void Zconsole::ZcommandTable::cmd_exit(zstrings _args) {
-	m_lpconsole->close(); 
-}  
-
-void Zconsole::ZcommandTable::cmd_help(zstrings _args) { 
-	zstring      dash, cnum, line;
-	unsigned int index, longest, numspaces, n;
-
-	m_lpconsole->print(" "); 
-	m_lpconsole->print(m_lpconsole->m_partition);  
-	 
-	if (!_args.empty()) { 
-		auto entry = m_commandmap.find(_args[0]);
-		if (entry != m_commandmap.end()) {
-			for (const auto& line : entry->second.help)
-				m_lpconsole->print(line);
-			m_lpconsole->print(m_lpconsole->m_partition); 
-			return;
-		}
-	} 	
-	index   = 0; 
-	longest = m_longestcmd.length();  
-	
-	for (auto& it : m_commandmap) { 
-		dash.clear();
-		numspaces = longest - it.first.length();
-		for (n = 0; n < numspaces; ++n) 
-			dash += " "; 
-		dash += " - ";
-
-		cnum = Zconsole_UintToHexString(index, "fmat2p");
-		line = cnum + " " + it.first + dash + it.second.help[0];
-		m_lpconsole->print(line); 
-		index++;
-	} 
-	m_lpconsole->print(m_lpconsole->m_partition);
-	line = 
-		"number of available commands: " +
-		std::to_string(index); 
-	m_lpconsole->print(line); 
-} 
- 
-
-void Zconsole::ZcommandTable::cmd_loadhistory(zstrings _args) { 
-	m_lpconsole->m_history->load();  
-} 
-
-
-void Zconsole::ZcommandTable::cmd_palette(zstrings _args) { 
-	zstring      cstr;
-	unsigned int index, tmp;
-
-	tmp = m_lpconsole->m_textcolor; 
-
-	m_lpconsole->print("");
-	m_lpconsole->print(m_lpconsole->m_partition);
-
-	for (index = 0x0; index < 0xB; ++index) { 
-		Zconsole_GetColorCodes(index, m_lpconsole->m_textcolor, cstr); 
-		m_lpconsole->print(
-			"This is text printed in color: " + 
-			Zconsole_UintToHexString(index,"fmat1np") + " " + cstr);
-	}
-	m_lpconsole->m_textcolor = tmp;
-	m_lpconsole->print(m_lpconsole->m_partition);
-} 
-  
-
-void Zconsole::ZcommandTable::cmd_savehistory(zstrings _args) { 
-	m_lpconsole->m_history->save(false); 
-} 
-
-
-void Zconsole::ZcommandTable::cmd_scale(zstrings _args) {  
-	zstring str;
-	float   fValue;
-
-	str    = "0.25";
-	fValue = 0.25f; 
-	 
-	if (_args.empty()) 
-		m_lpconsole->print("scale set to default value"); 
-	else {
-		if (!_args.empty() && !_args[0].empty())
-			str = _args[0];
-
-		if (str != "default" && str != "0.25") {
-			fValue = Zconsole_StringToFloat(str);
-			if (fValue < 0.15f) {
-				fValue = 0.15f;
-				str = "value scale range is between 0.15 - 1.00";
-			}
-			if (fValue > 1.f) {
-				fValue = 1.f;
-				str = "value scale range is between 0.15 - 1.00";
-			}
-		}
-	}
-	m_lpconsole->m_renderscale = fValue;
-
-	m_lpconsole->print(str);  
-	m_lpconsole->print(" ");  
-} 
-
-
-void Zconsole::ZcommandTable::cmd_showhistory(zstrings _args) { 
-	m_lpconsole->m_history->print();
-} 
-
-
-void Zconsole::ZcommandTable::cmd_ver(zstrings _args) {
-	m_lpconsole->print(m_lpconsole->getVersion());
-} 
-/*****************************************************************************/  
-//EOF
-/*****************************************************************************/  
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zcommandtable.cpp
+* Desc: interface for console commands
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/  
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include "zhelperfuncs.hpp"  
+#include "zhistory.hpp"
+#include "zlogtable.hpp"
+#include "zconsoledefs.hpp"
+#include "zscreen.hpp"
+#include "zthreadlog.hpp"
+#include "zcommandtable.hpp" 
+
+
+
+ 
+
+/* Section 1:
+** Initialization and Command parsing*/
+//***************************************************************************//
+void Zconsole::ZcommandTable::initHelpTextTable(
+	std::map<zstring, zstrings>& _table) const {  
+	
+#define CMD_NO_ARGS \
+      "If no argument is given, command will be ignored",\
+      "or will display the current configuration."
+
+#define VALID_BOOL_ARGS "", \
+      "1 		 0      ",  \
+      "on 	     off    ",  \
+      "set       unset  ",  \
+      "true	     false  ",  \
+      "enable    disable",  \
+      CMD_NO_ARGS,       "" 
+	 
+	_table["cls"] = {
+		"clears the console screen.",
+		"Example: \"cls\"",
+	};
+	_table["color"] = {
+		"sets the default console text color.",
+		"color [attr] - (attr) specifies color identified by a hex digit",
+		"                      digit can be any of the following values:",
+		"",
+		"0 = Green     6 = Cyan		",
+		"1 = Brown     7 = Magenta  ",
+		"2 = Amber     8 = Lt Green ",
+		"3 = Grey      9 = Blue 	",
+		"4 = Red       A = White    ",
+		"5 = Purple                 ",
+		"",
+		CMD_NO_ARGS,
+		"Example: \"color 0\" produces green text",
+	};  
+	_table["delhistory"] = {
+	   "clears the command history.",
+	   "Example: \"delhistory\"",
+	};
+	_table["echo"] = {
+		"displays messages, or turns command-echoing on or off.",
+		"",
+		"echo [on | off]",
+		"echo [message]",
+		"",
+		"Or type \"echo\" w/o parameters to display current echo setting.",
+	};
+	_table["exit"] = {
+		"quits the command interpretor",
+		"example: \"exit\"",
+	}; 
+	_table["filter"] = {
+		"shows only the scrollback lines matching an expression.",
+		"filter [regex] - (regex) is a regular expression, case is ignored.",
+		"                 lines are matched in the background and the",
+		"                 view fills up as they are, only the first",
+		"                 1024 characters of a line are matched.",
+		"",
+		"Type \"filter\" w/o parameters to show every line again.",
+		"Example: \"filter error|warn\"",
+	};
+	_table["find"] = {
+		"searches the scrollback and scrolls to the match.",
+		"find [text]  - finds the newest line holding text, matches",
+		"               are highlighted (case is ignored)",
+		"find next    - goes to the next older match        (F3)",
+		"find prev    - goes back to the next newer match   (shift+F3)",
+		"",
+		"Type \"find\" w/o parameters to clear the highlighting.",
+		"Example: \"find error\"",
+	};
+	_table["help"] = {
+		"provides help information for console commands.",
+		"help [command] - (command) displays help information on command.",
+		"",
+		"example: \"help color\"",
+	};
+	_table["loadhistory"] = {
+		"loads previously saved command history from disk",
+		"example: \"loadhistory\"",
+	};
+	_table["palette"] = {
+		"demonstrates the palette by printing in each color.",
+		"example: \"palette\"",
+	};
+	_table["render"] = {
+		"selects the backend used to draw the console.",
+		"render [mode] - (mode) can be any of the following values:",
+		"",
+		"array  = vertices are sent to the gpu every frame",
+		"buffer = vertices stay on the gpu, only changes are sent",
+		"grid   = one quad, cells are drawn by a shader",
+		"",
+		"render cache [on | off] - draws the console through a texture",
+		"                          that is only redrawn on changes",
+		"",
+		CMD_NO_ARGS,
+		"Example: \"render buffer\"",
+	};
+	_table["savehistory"] = {
+		"saves the command history to a text file on diskr",
+		"example: \"savehistory\"",
+	}; 
+	_table["scale"] = {
+	    "define the scale factor the console is rendered at.",
+	    "example: \"scale\"",
+	};
+	_table["scrollback"] = {
+		"displays or configures the scrollback storage.",
+		"older lines are kept in compressed blocks, the report shows",
+		"their compression ratio and the memory they hold.",
+		"",
+		"scrollback spill [on | off] - lines dropped from memory are kept",
+		"                              in a file and stay scrollable",
+		"scrollback maxbytes [size]  - memory lines may take, oldest lines",
+		"                              are dropped past it (e.g. 512k, 8m)",
+		"",
+		CMD_NO_ARGS,
+		"Example: \"scrollback maxbytes 8m\"",
+	};
+	_table["showhistory"] = {
+		"displays command history",
+		"example: \"showhistory\"",
+	};   
+	_table["loadstate"] = {
+		"load a state into memory.", 
+		CMD_NO_ARGS,
+		"Example: \"loadstate test\" loads the test program into memory",
+	};
+	_table["thread"] = {
+		"lists the threads logging through their own buffers, or",
+		"shows only the lines of one of them. Their lines start with",
+		"the id of the thread, as in [T3].",
+		"",
+		"thread [id] - shows only the lines of thread (id)",
+		"thread all  - shows the lines of every thread again",
+		"",
+		CMD_NO_ARGS,
+		"Example: \"thread 3\"",
+	};
+	_table["ver"] = {
+	   "displays the console version",
+	   "example: \"ver\"",
+	}; 
+#undef CMD_NO_ARGS
+#undef VALID_BOOL_ARGS 
+} 
+
+
+void Zconsole::ZcommandTable::initialize() { 
+	std::vector<zcommand> commandlist;
+	{
+		zcommand command;
+	    #define BIND(x)\
+            std::bind(&ZcommandTable::x, this, std::placeholders::_1)  
+
+		command.name = "cls";
+		command.func = BIND(cmd_cls);
+		commandlist.push_back(command);
+
+		command.name = "color";
+		command.func = BIND(cmd_color);
+		commandlist.push_back(command);
+
+		command.name = "delhistory";
+		command.func = BIND(cmd_delhistory);
+		commandlist.push_back(command);
+
+		command.name = "echo";
+		command.func = BIND(cmd_echo);
+		commandlist.push_back(command);
+
+		command.name = "exit";
+		command.func = BIND(cmd_exit);
+		commandlist.push_back(command);
+
+		command.name = "filter";
+		command.func = BIND(cmd_filter);
+		commandlist.push_back(command);
+
+		command.name = "find";
+		command.func = BIND(cmd_find);
+		commandlist.push_back(command);
+
+		command.name = "help";
+		command.func = BIND(cmd_help);
+		commandlist.push_back(command);
+
+		command.name = "loadhistory";
+		command.func = BIND(cmd_loadhistory);
+		commandlist.push_back(command);		
+
+		command.name = "palette";
+		command.func = BIND(cmd_palette);
+		commandlist.push_back(command);
+
+		command.name = "render";
+		command.func = BIND(cmd_render);
+		commandlist.push_back(command);
+
+		command.name = "savehistory";
+		command.func = BIND(cmd_savehistory);
+		commandlist.push_back(command);
+
+		command.name = "scale";
+		command.func = BIND(cmd_scale);
+		commandlist.push_back(command); 
+
+		command.name = "scrollback";
+		command.func = BIND(cmd_scrollback);
+		commandlist.push_back(command); 
+
+		command.name = "showhistory";
+		command.func = BIND(cmd_showhistory);
+		commandlist.push_back(command); 
+
+		command.name = "thread";
+		command.func = BIND(cmd_thread);
+		commandlist.push_back(command); 
+
+		command.name = "ver";
+		command.func = BIND(cmd_ver);
+		commandlist.push_back(command);
+	#undef BIND
+	}
+	m_commandmap.clear(); 
+	
+	std::map<zstring, zstrings> helptext;
+	initHelpTextTable(helptext);
+
+	for (auto& it : commandlist) {
+		auto help = helptext.find(it.name);
+		if (help != helptext.end())
+			it.help = help->second;
+
+		if (!insert(it)) { 
+			return;
+		}
+	}  
+} 
+
+
+bool Zconsole::ZcommandTable::insert(const zcommand& _command) {  
+	auto entry = m_commandmap.find(_command.name);
+	if (entry == m_commandmap.end()) {
+		m_commandmap.insert(std::make_pair(_command.name, _command));
+		if (m_longestcmd.length() < _command.name.length()) 
+			m_longestcmd = _command.name; 
+		return true;
+	}
+	return false; 
+}
+
+
+bool Zconsole::ZcommandTable::remove(const zcommand& _command) {
+	auto entry = m_commandmap.find(_command.name);
+	if (entry != m_commandmap.end()) {
+		m_commandmap.erase(_command.name);
+		return true;
+	}
+	return false;
+}
+
+
+void Zconsole::ZcommandTable::run(zstrings& _args) {
+	static zstring lastcommand;
+	lastcommand = "";
+
+	const auto it = m_commandmap.find(_args[0]);
+	if (it != m_commandmap.end()) {
+		/*
+		Remove command name and empty args:*/
+		_args.erase(_args.begin());
+		for (auto it = _args.begin(); it != _args.end();) {
+			if (!it->empty()) ++it;
+			else it = _args.erase(it);
+		}
+		//lowercase:
+		for (auto& it : _args) {
+			it = Zconsole_StringToLower(it);
+		}
+		lastcommand = it->second.name;
+		it->second.func(_args);
+	}
+	else {
+		m_lpconsole->print("unknown command: {}", _args[0]);
+	}
+	m_lpconsole->print(" ");
+} 
+
+
+ 
+
+
+/* Section 2:
+** Command function definitions*/
+//***************************************************************************//
+void Zconsole::ZcommandTable::cmd_cls(zstrings _args) {
+	m_lpconsole->m_screen->clear();
+	m_lpconsole->print("console screen cleared"); 
+} 
+ 
+
+void Zconsole::ZcommandTable::cmd_color(zstrings _args) {
+	unsigned int rgba = m_lpconsole->m_textcolor; //rgba color code
+	zstring      cstr = "";                       //color string 
+	 
+	if (_args.empty()) { 
+		Zconsole_GetColorCodes(rgba, rgba, cstr);
+		m_lpconsole->print("console font color is set to: {}", cstr);
+		return;
+	} 
+	rgba = Zconsole_HexStringToUint(_args[0].c_str());
+	if (rgba > 0xA) 
+		m_lpconsole->print("invalid command arguments"); 
+	else {
+		Zconsole_GetColorCodes(rgba, rgba, cstr);
+		m_lpconsole->m_textcolor = rgba;
+		m_lpconsole->print("console font color was set to: {}", cstr);
+	}
+} 
+ 
+
+void Zconsole::ZcommandTable::cmd_delhistory(zstrings _args) { 
+	m_lpconsole->m_history->clear();
+} 
+ 
+
+void Zconsole::ZcommandTable::cmd_echo(zstrings _args) {  
+	if (!_args.empty() && !_args[0].empty()) 
+		m_lpconsole->print(_args[0]); 
+	else m_lpconsole->print("echo is enabled"); 
+	m_lpconsole->print(" ");
+}
+ 
+
+void Zconsole::ZcommandTable::cmd_exit(zstrings _args) {
+	m_lpconsole->close(); 
+}  
+
+void Zconsole::ZcommandTable::cmd_filter(zstrings _args) {
+	zstring pattern;
+
+	//words are rejoined, quotes only group them
+	for (const auto& it : _args) {
+		if (!pattern.empty())
+			pattern += ' ';
+		pattern += it;
+	}
+	pattern.erase(
+		std::remove(pattern.begin(), pattern.end(), '"'), pattern.end());
+
+	if (!m_lpconsole->m_screen->setFilter(pattern)) {
+		m_lpconsole->print("invalid regular expression: {}", pattern);
+		return;
+	}
+	if (pattern.empty())
+		m_lpconsole->print("filter removed");
+	else m_lpconsole->print("filter set to: {}", pattern);
+}
+
+
+void Zconsole::ZcommandTable::cmd_find(zstrings _args) {
+	zstring text;
+	bool    forward = false;
+
+	if (_args.empty()) {
+		m_lpconsole->m_screen->clearFind();
+		m_lpconsole->print("search cleared");
+		return;
+	}
+	if (_args.size() == 1 && (_args[0] == "next" || _args[0] == "prev"))
+		forward = _args[0] == "prev";
+	else {
+		//words are rejoined, quotes only group them
+		for (const auto& it : _args) {
+			if (!text.empty())
+				text += ' ';
+			text += it;
+		}
+		text.erase(std::remove(text.begin(), text.end(), '"'), text.end());
+		if (text.empty()) {
+			m_lpconsole->print("invalid command arguments");
+			return;
+		}
+	}
+	if (!m_lpconsole->m_screen->find(text, forward))
+		m_lpconsole->print("no further match found");
+}
+
+
+void Zconsole::ZcommandTable::cmd_help(zstrings _args) { 
+	zformat      line;
+	zstrings     lines;
+	unsigned int index;
+	char         format[32];
+
+	lines.push_back(" "); 
+	lines.push_back(m_lpconsole->m_partition);  
+	 
+	if (!_args.empty()) { 
+		auto entry = m_commandmap.find(_args[0]);
+		if (entry != m_commandmap.end()) {
+			for (const auto& line : entry->second.help)
+				lines.push_back(line);
+			lines.push_back(m_lpconsole->m_partition); 
+			m_lpconsole->printLines(lines);
+			return;
+		}
+	} 	
+	index = 0; 
+	lines.reserve(m_commandmap.size() + 4);
+
+	//names are padded to the longest one so descriptions line up
+	snprintf(format, sizeof(format), 
+		"{:02X} {:%u} - {}", (unsigned int)m_longestcmd.length());
+	
+	for (auto& it : m_commandmap) { 
+		Zconsole_FormatLine(line, format, index, it.first, it.second.help[0]);
+		lines.emplace_back(line.text, line.size); 
+		index++;
+	} 
+	lines.push_back(m_lpconsole->m_partition);
+	Zconsole_FormatLine(line, "number of available commands: {}", index); 
+	lines.emplace_back(line.text, line.size); 
+	m_lpconsole->printLines(lines);
+} 
+ 
+
+void Zconsole::ZcommandTable::cmd_loadhistory(zstrings _args) { 
+	m_lpconsole->m_history->load();  
+} 
+
+
+void Zconsole::ZcommandTable::cmd_palette(zstrings _args) { 
+	zstring      cstr;
+	unsigned int index, tmp;
+
+	tmp = m_lpconsole->m_textcolor; 
+
+	m_lpconsole->print("");
+	m_lpconsole->print(m_lpconsole->m_partition);
+
+	for (index = 0x0; index < 0xB; ++index) { 
+		Zconsole_GetColorCodes(index, m_lpconsole->m_textcolor, cstr); 
+		m_lpconsole->print("This is text printed in color: {:X} {}", index, cstr);
+	}
+	m_lpconsole->m_textcolor = tmp;
+	m_lpconsole->print(m_lpconsole->m_partition);
+} 
+  
+
+void Zconsole::ZcommandTable::cmd_render(zstrings _args) { 
+	static const zstring modenames[] = { "array", "buffer", "grid" };
+
+	zrendermode  mode;
+	unsigned int index;
+
+	if (_args.empty()) {
+		mode = m_lpconsole->getRenderMode();
+		m_lpconsole->print("render mode is set to: {}", modenames[mode]);
+		return;
+	}
+	if (_args[0] == "cache") {
+		const int enable = 
+			_args.size() > 1 ? Zconsole_ArgToBool(_args[1]) : -1;
+
+		if (enable < 0) {
+			m_lpconsole->print("invalid command arguments");
+			return;
+		}
+		m_lpconsole->setRenderCache(enable == 1);
+		m_lpconsole->print(
+			enable ? "render cache enabled" : "render cache disabled");
+		return;
+	}
+	for (index = 0; index < 3; ++index) {
+		if (_args[0] == modenames[index])
+			break;
+	}
+	if (index == 3) {
+		m_lpconsole->print("invalid command arguments");
+		return;
+	}
+	mode = (zrendermode)index;
+	if (!m_lpconsole->setRenderMode(mode)) {
+		m_lpconsole->print("render mode {} is unavailable", modenames[mode]);
+	}
+	mode = m_lpconsole->getRenderMode();
+	m_lpconsole->print("render mode was set to: {}", modenames[mode]);
+} 
+
+
+void Zconsole::ZcommandTable::cmd_savehistory(zstrings _args) { 
+	m_lpconsole->m_history->save(false); 
+} 
+
+
+void Zconsole::ZcommandTable::cmd_scale(zstrings _args) {  
+	zstring str;
+	float   fValue;
+
+	str    = "0.25";
+	fValue = 0.25f; 
+	 
+	if (_args.empty()) 
+		m_lpconsole->print("scale set to default value"); 
+	else {
+		if (!_args.empty() && !_args[0].empty())
+			str = _args[0];
+
+		if (str != "default" && str != "0.25") {
+			fValue = Zconsole_StringToFloat(str);
+			if (fValue < 0.15f) {
+				fValue = 0.15f;
+				str = "value scale range is between 0.15 - 1.00";
+			}
+			if (fValue > 1.f) {
+				fValue = 1.f;
+				str = "value scale range is between 0.15 - 1.00";
+			}
+		}
+	}
+	m_lpconsole->m_renderscale = fValue;
+
+	m_lpconsole->print(str);  
+	m_lpconsole->print(" ");  
+} 
+
+
+void Zconsole::ZcommandTable::cmd_scrollback(zstrings _args) {
+	const auto& scrollback = m_lpconsole->m_screen->getScrollback();
+
+	if (_args.empty()) {
+		const auto& cold = scrollback.getColdStore();
+		m_lpconsole->print(
+			"scrollback: {} lines, {} bytes in the arena", 
+			scrollback.getLineCount(), scrollback.getBytesUsed());
+		m_lpconsole->print(
+			"cold      : {} lines in {} blocks, ratio {:.2}", 
+			cold.getLineCount(), cold.getBlockCount(), cold.getRatio());
+		m_lpconsole->print(
+			"            {} bytes raw, {} bytes resident", 
+			cold.getRawBytes(), cold.getResidentBytes());
+		m_lpconsole->print(
+			"memory    : {} of {} bytes held", 
+			scrollback.getBytesHeld(), scrollback.getMaxBytes());
+		m_lpconsole->print(
+			"spill     : {} lines on disk", scrollback.getSpillCount());
+		m_lpconsole->print(
+			"rows      : {} scrollable", scrollback.getRowCount());
+		m_lpconsole->print(
+			"log       : {} call sites", m_lpconsole->m_logtable->getSiteCount());
+		return;
+	}
+	if (_args[0] == "spill") {
+		const int enable = 
+			_args.size() > 1 ? Zconsole_ArgToBool(_args[1]) : -1;
+
+		if (enable < 0) {
+			m_lpconsole->print("invalid command arguments");
+			return;
+		}
+		const zstring filepath = 
+			enable ? m_lpconsole->m_directory + "conspill.bin" : "";
+
+		if (!m_lpconsole->setScrollbackSpill(filepath))
+			m_lpconsole->print("unable to create spill file: {}", filepath);
+		else m_lpconsole->print(
+			enable ? "scrollback spill enabled" : "scrollback spill disabled");
+		return;
+	}
+	if (_args[0] == "maxbytes") {
+		const unsigned long long bytes = 
+			_args.size() > 1 ? Zconsole_StringToByteCount(_args[1]) : 0;
+
+		if (_args.size() > 1 && bytes == 0) {
+			m_lpconsole->print("invalid command arguments");
+			return;
+		}
+		if (bytes == 0) {
+			m_lpconsole->print(
+				"scrollback budget is set to: {} bytes", scrollback.getMaxBytes());
+			return;
+		}
+		m_lpconsole->setScrollbackMaxBytes(bytes);
+		m_lpconsole->print("scrollback budget was set to: {} bytes", bytes);
+		return;
+	}
+	m_lpconsole->print("invalid command arguments");
+} 
+
+
+void Zconsole::ZcommandTable::cmd_showhistory(zstrings _args) { 
+	m_lpconsole->m_history->print();
+} 
+
+
+void Zconsole::ZcommandTable::cmd_thread(zstrings _args) {
+	if (_args.empty()) {
+		const auto threads = m_lpconsole->m_threadlog->getThreads();
+		if (threads.empty()) {
+			m_lpconsole->print("no thread has logged");
+			return;
+		}
+		for (const auto& it : threads) {
+			m_lpconsole->print(
+				"thread {}: {} lines, {} dropped{}", it.id, it.lines, 
+				it.dropped, it.exited ? " (exited)" : "");
+		}
+		return;
+	}
+	if (_args[0] == "all") {
+		m_lpconsole->m_screen->setFilter("");
+		m_lpconsole->print("showing the lines of every thread");
+		return;
+	}
+	const zstring& id = _args[0];
+	if (id.empty() || id.size() > 9 || 
+		!std::all_of(id.begin(), id.end(), 
+			[](char _c) { return isdigit((unsigned char)_c) != 0; })) {
+		m_lpconsole->print("invalid command arguments");
+		return;
+	}
+	//the filter ignores case, the id is written without leading zeros
+	const unsigned long number = std::stoul(id);
+	m_lpconsole->m_screen->setFilter(
+		"^\\[t" + std::to_string(number) + "\\] ");
+	m_lpconsole->print("showing the lines of thread {}", number);
+}
+
+
+void Zconsole::ZcommandTable::cmd_ver(zstrings _args) {
+	m_lpconsole->print(m_lpconsole->getVersion());
+} 
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
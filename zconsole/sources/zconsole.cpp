@@ -1,459 +1,808 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: zconsole.cpp
-* Desc: interface for console 
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/  
-#include "zconsoledefs.hpp"
-#include "zfontdata.hpp"
-#include "ztimers.hpp"
-#include "zhelperfuncs.hpp" 
-#include "zcommandtable.hpp"  
-#include "zscreen.hpp"
-#include "zhistory.hpp"
-#include "zcursor.hpp" 
-#include "zconsole/zconsole.hpp" 
-
- 
-
-
-Zconsole::Zconsole() {}
-Zconsole::~Zconsole() {}
-
-
-bool Zconsole::initialize(const zstring& _directory) {  
-	static bool initialized = false;
-	if (!initialized) {  
-
-		m_font.reset(new sf::Font());
-		m_font->loadFromMemory(
-		    s_zconsole_fontdata, 
-			sizeof(s_zconsole_fontdata));
-
-		m_entrykeyflag = true;  
-		m_renderscale  = ZCONSOLE_DEFAULTSCALE; 
-
-		m_partition.clear();
-		while (m_partition.length() < ZCONSOLE_WIDTH - 2) {
-			m_partition += "-";
-		}
-		m_cursor.reset(new Zcursor(this));
-	    m_history.reset(new Zhistory(this)); 
-		m_screen.reset(new Zscreen(this));
-		m_commandtable.reset(new ZcommandTable(this));     
-	   
-	    m_cursor->initialize();
-	    m_history->initialize(_directory); 
-		m_screen->initialize();
-		m_commandtable->initialize();
-
-	    parseLastLine(false); 
-		initialized = true;
-	} 
-	return initialized;
-} 
-
-
-void Zconsole::release() {
-	m_history->save(false);
-	m_screen.reset();
-	m_cursor.reset();
-	m_history.reset();
-	m_commandtable.reset();	 
-} 
-
-
-bool Zconsole::insertCommand(const zcommand& _command) {
-	return m_commandtable->insert(_command);
-}  
-
-
-bool Zconsole::removeCommand(const zcommand& _command) {
-	return m_commandtable->remove(_command);
-}
-
-
-void Zconsole::print(const zstring& _string) {
-	m_screen->echoLine(_string);
-}
-
-
-void Zconsole::setDirectory(const zstring& _directory) {
-	m_history->setDirectory(_directory);
-}
-
-
-const sf::Font* const Zconsole::getFont() const {
-	return m_font.get();
-}
-
-
-void Zconsole::open() {  
-	m_entrykeyflag = true;  
-	m_isOpenFlag   = true;  
-	
-	m_screen->clear(); 
-	print(getVersion());
-	print("(C) 2015-2021 Zachary T Harris. All rights reserved.");
-	print(" ");
-}  
-
-
-void Zconsole::close() { 
-	 m_screen->clear(); 
-	 m_isOpenFlag = false;  
-}  
-
-
-void Zconsole::onEvent(const sf::Event& _event) {   
-	if (!m_isOpenFlag) {
-		return;
-	}
-	if (m_entrykeyflag) {
-		if (!sf::Keyboard::isKeyPressed(ZCONSOLE_ENTRYKEY))
-			m_entrykeyflag = false;
-		return;
-	} 
-	switch (_event.type) {
-	case sf::Event::TextEntered:
-		m_cursor->addChar((char)(_event.text.unicode));
-		break;
-
-	case sf::Event::KeyPressed:
-		if (_event.key.control) {
-			switch (_event.key.code) {
-			case sf::Keyboard::Left:
-				m_cursor->moveOneWord(-1);
-				break;
-			case sf::Keyboard::Right:
-				m_cursor->moveOneWord(+1);
-				break;
-			case sf::Keyboard::Up:
-				m_screen->scroll(-1);
-				break;
-			case sf::Keyboard::Down: 
-				m_screen->scroll(1);
-				break;
-			case sf::Keyboard::Home:  
-				m_screen->scroll(ZCONSOLE_SCROLLBEGIN);
-				break;
-			case sf::Keyboard::End:  
-				m_screen->scroll(ZCONSOLE_SCROLLEND);
-				break;
-			case sf::Keyboard::PageDown:
-				m_screen->scroll(ZCONSOLE_HEIGHT - 3);
-				break;
-			case sf::Keyboard::PageUp: 
-				m_screen->scroll(-(ZCONSOLE_HEIGHT - 3));
-				break; 
-			}
-		}
-		else {
-			switch (_event.key.code) {
-			case sf::Keyboard::Backspace:
-				m_cursor->backspace();
-				break;
-			case sf::Keyboard::Delete:
-				m_cursor->erase();
-				break;
-			case sf::Keyboard::Enter:
-				parseLastLine(1);
-				break;
-			case sf::Keyboard::Left:
-				m_cursor->move(-1);
-				break;
-			case sf::Keyboard::Right: 
-				m_cursor->move(1);
-				break;
-			case sf::Keyboard::End:  
-				m_cursor->move(ZCONSOLE_CURSOREND);
-				break;
-			case sf::Keyboard::Home: 
-				m_cursor->move(ZCONSOLE_CURSORHOME);
-				break;
-			case sf::Keyboard::Up:      
-				scrollHistory(-1);
-				break;
-			case sf::Keyboard::Down:   
-				scrollHistory(1);
-				break;
-			case sf::Keyboard::Escape:  
-				close();
-				return; 
-			}
-		} 
-	}  
-} 
-
-
-void Zconsole::onPresent(
-	sf::RenderTarget& _rendertarget,
-	sf::RenderStates  _renderstates) {
-
-	if (!m_isOpenFlag) {
-		return;
-	}
-	const auto& originalview = _rendertarget.getView();
-
-	_renderstates.texture = &m_font->getTexture(ZCONSOLE_FONTSIZE);
-
-	auto transform = sf::Transform::Identity;
-	transform.scale(m_renderscale, m_renderscale);
-	_renderstates.transform *= transform;
-
-	const auto size = _rendertarget.getSize();
-	const auto rect = 
-		sf::FloatRect(
-			-15.f, -10.f, 
-			(float)size.x, (float)size.y);
-
-	_rendertarget.setView(sf::View(rect));
-	_rendertarget.draw(
-		m_vertices.data(),
-		m_vertices.size(),
-		sf::Triangles,
-		_renderstates);
-
-	_rendertarget.setView(originalview);
-}
-
-
-bool Zconsole::onUpdate(float _delta) {    
-	pollInput();
-	m_cursor->update();	 
-
-	int   ix, iy, ir, ib;
-	float px, py, pr, pb; 
-	 
-	static unsigned int lastpendingupdates = 0;
-	if (!m_font ||
-		lastpendingupdates == m_pendingUpdates) {
-		return m_isOpenFlag;
-	} 
-	lastpendingupdates = m_pendingUpdates;  
-	auto* screen = m_screen->getCellMatrix(); 
-	/*--------------------------------------------*/ 
-	/*--------------------------------------------*/ 
-	
-	
-	 
-	//reserve 6 vertices(2 triangles) for background
-	m_vertices.clear(); 
-	m_vertices.push_back(sf::Vertex());
-	m_vertices.push_back(sf::Vertex());
-	m_vertices.push_back(sf::Vertex());
-	m_vertices.push_back(sf::Vertex());	 
-	m_vertices.push_back(sf::Vertex());
-	m_vertices.push_back(sf::Vertex());
-
-	//Precompute the variables needed by the algorithm
-	float hspace  = m_font->getGlyph(L' ', ZCONSOLE_FONTSIZE, 0).advance;
-	float vspace  = m_font->getLineSpacing(ZCONSOLE_FONTSIZE);
-	float xoffset = 0.f;					  
-	float yoffset = ZCONSOLE_FONTSIZE; 
-
-	unsigned int prevChar = 0u;  
-
-	 
-	/*-----------------------------------------------------------------------*/ 
-	/*-----------------------------------------------------------------------*/
-	for (unsigned int A = 0; A < ZCONSOLE_TOTALSIZE; ++A) {
-		unsigned int curChar = screen[A].mchar; 
-		/*move the reserved vertices so they won't affect the bounds*/
-		if (A == 1u) {
-			m_vertices[0].position = m_vertices[6].position;
-			m_vertices[1].position = m_vertices[6].position;
-			m_vertices[2].position = m_vertices[6].position;
-			m_vertices[3].position = m_vertices[6].position;
-			m_vertices[4].position = m_vertices[6].position;
-			m_vertices[5].position = m_vertices[6].position; 
-		}
-		/*Apply the kerning offset*/
-		xoffset += m_font->getKerning(
-			prevChar, 
-			curChar, 
-			ZCONSOLE_FONTSIZE); 
-
-		prevChar = curChar; 
-	
-	    /*add a cursor under the glyph if this is the right position*/		 
-		const int cursorposOffset = 
-			(ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 2)) +
-			((int)(m_cursor->getPosition() - m_lastlineOffset));
-
-		if (cursorposOffset == A) { 
-			m_cursor->reset(xoffset, yoffset); 
-		}
-		/*Handle spaces*/
-		switch (curChar) {
-		case '\t': case '\n': case ' ':
-			xoffset += hspace;
-			continue;
-		} 
-		/*Extract the current glyph's description*/
-		const sf::Glyph& glyph = 
-			m_font->getGlyph(curChar, ZCONSOLE_FONTSIZE, false);
-
-		ix = (int)(floor(glyph.bounds.left) + xoffset);
-		iy = (int)(floor(glyph.bounds.top) + yoffset);
-		ir = (int)(ceil(glyph.bounds.left + glyph.bounds.width) + xoffset);
-		ib = (int)(ceil(glyph.bounds.top + glyph.bounds.height) + yoffset);
-
-		px = (float)ix;
-		py = (float)iy;
-		pr = (float)ir;
-		pb = (float)ib;
-
-		const float ux = (float)(glyph.textureRect.left);
-		const float uy = (float)(glyph.textureRect.top);
-		const float ur = (float)(ux + glyph.textureRect.width);
-		const float ub = (float)(uy + glyph.textureRect.height);
-
-		{/*Add a quad for the current character*/
-			const sf::Color col = 
-				Zconsole_GetColorFromUint(screen[A].color);
-
-		    m_vertices.push_back(sf::Vertex({ px, py }, col, { ux, uy }));
-		    m_vertices.push_back(sf::Vertex({ pr, py }, col, { ur, uy }));
-		    m_vertices.push_back(sf::Vertex({ px, pb }, col, { ux, ub }));
-		    m_vertices.push_back(sf::Vertex({ px, pb }, col, { ux, ub }));
-		    m_vertices.push_back(sf::Vertex({ pr, py }, col, { ur, uy }));
-		    m_vertices.push_back(sf::Vertex({ pr, pb }, col, { ur, ub }));
-		}													   
-		{/*Advance to the next character*/
-			xoffset += glyph.advance;
-			if ((A + 1) % ZCONSOLE_WIDTH == 0) {
-				yoffset += vspace;
-				xoffset = 0;
-				prevChar = '\n';
-			}
-		}
-	}   
-	/*-----------------------------------------------------------------------*/ 
-	/*-----------------------------------------------------------------------*/
-	{//fill the reserved background vertices	 
-		const auto bounds = Zconsole_GetVerticesBounds(m_vertices); 
-
-		px = floor(bounds.left);
-		py = floor(bounds.top);
-		pr = ceil(bounds.left + bounds.width);
-		pb = ceil(bounds.top + bounds.height);
-		 
-		m_vertices[0] = sf::Vertex({ px, py }, sf::Color::Black, { 1.f, 1.f }); 
-		m_vertices[1] = sf::Vertex({ pr, py }, sf::Color::Black, { 1.f, 1.f }); 
-		m_vertices[2] = sf::Vertex({ px, pb }, sf::Color::Black, { 1.f, 1.f }); 
-		m_vertices[3] = sf::Vertex({ px, pb }, sf::Color::Black, { 1.f, 1.f }); 
-		m_vertices[4] = sf::Vertex({ pr, py }, sf::Color::Black, { 1.f, 1.f }); 
-		m_vertices[5] = sf::Vertex({ pr, pb }, sf::Color::Black, { 1.f, 1.f });  
-	} 
-	return m_isOpenFlag;
-} 
-
-
-void Zconsole::processNextCommand() { 
-	size_t   comment;
-	zstrings commandList;
-	zstring  cmd, argString;
-
-	if (m_commandbuffer.empty()) {
-		return;
-	}
-	/*
-	Allow commands in quotes as single String:
-	-----------------------------------------*/
-	comment = m_commandbuffer.find_first_of('"');
-
-	if (comment != zstring::npos) {
-		cmd = m_commandbuffer.substr(0u, comment);
-		argString = m_commandbuffer.substr(
-			m_commandbuffer.find_first_of('"'),
-			m_commandbuffer.find_last_of('"'));
-	}
-	else { cmd = m_commandbuffer; }
-	
-	/*
-	Remove prompt characters:
-	-----------------------------------------*/
-	for (unsigned int i = 0; i < zstring(ZCONSOLE_PROMPT).size(); ++i) {
-		cmd.erase(cmd.begin());
-	} 
-	/*
-	Split into command and arguments:
-	-----------------------------------------*/
-	commandList = Zconsole_TokenizeString(cmd, ' ');
-	if (!commandList.empty()) {
-		commandList[0] = 
-			Zconsole_StringToLower(commandList[0]);
-		commandList.push_back(argString);
-		m_commandtable->run(commandList);
-	}
-} 
-
- 
-void Zconsole::parseLastLine(bool _isCommandEntry) {
-	print(m_lastline);
-	m_history->update();
-
-	m_commandbuffer += m_lastline;
-
-	if (_isCommandEntry) {
-		processNextCommand();
-	}
-	m_commandbuffer.clear();
-	m_lastline.clear();
-	m_cursor->setPosition(1);
-	m_lastlineOffset = 0;
-	++m_pendingUpdates;
-	/*
-	Reset prompt:*/
-	m_lastline += zstring(ZCONSOLE_PROMPT);
-	m_cursor->moveOneWord(-1);
-} 
-
-
-void Zconsole::pollInput() { 
-	static ZtimedInputKey kbackspace(sf::Keyboard::BackSpace);
-	static ZtimedInputKey kscrollup(sf::Keyboard::Up);
-	static ZtimedInputKey kscrolldown(sf::Keyboard::Down);
-
-	if (kbackspace.isPressed())
-		m_cursor->backspace();
-	else {
-		if (sf::Keyboard::isKeyPressed(sf::Keyboard::LControl)) {
-			if (kscrollup.isPressed())
-				m_screen->scroll(-1);
-			else if (kscrolldown.isPressed())
-				m_screen->scroll(+1);
-		}
-	}
-}
-
-
-void Zconsole::scrollHistory(int _direction) {
-	m_history->read(_direction);
-	m_lastlineOffset = 0;
-	m_cursor->move(ZCONSOLE_CURSOREND);
-	++m_pendingUpdates;
-}
-/*****************************************************************************/  
-//EOF
-/*****************************************************************************/ 
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zconsole.cpp
+* Desc: interface for console 
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/  
+#include "zconsoledefs.hpp"
+#include "zfontdata.hpp"
+#include "zfontatlas.hpp"
+#include "ztimers.hpp"
+#include "zhelperfuncs.hpp" 
+#include "zcommandtable.hpp"  
+#include "zscreen.hpp"
+#include "zhistory.hpp"
+#include "zcursor.hpp" 
+#include "zglyphtable.hpp"
+#include "zrenderer.hpp"
+#include "zvertexarena.hpp"
+#include "zlogtable.hpp"
+#include "zprintqueue.hpp"
+#include "zthreadlog.hpp"
+#include "zconsole/zconsole.hpp" 
+
+ 
+
+
+Zconsole::Zconsole() :
+	//other threads may post at any time, these outlive initialize()
+	m_printqueue(new ZprintQueue(ZCONSOLE_QUEUESIZE)),
+	m_threadlog(new ZthreadLog()) {}
+Zconsole::~Zconsole() {}
+
+
+bool Zconsole::initialize(const zstring& _directory) {  
+	static bool initialized = false;
+	if (!initialized) {  
+
+		m_entrykeyflag   = true;  
+		m_layoutdirty    = true;
+		m_renderscale    = ZCONSOLE_DEFAULTSCALE; 
+		m_hostscale      = 1.f;
+		m_charsize       = Zconsole_GetCharacterSize(
+			ZCONSOLE_FONTSIZE * m_renderscale);
+		m_charsizefailed = 0;
+
+		m_glyphtable.reset(new ZglyphTable(this));
+		rebuildGlyphs();
+
+		//the only allocation of console vertices
+		m_vertices.reset(new ZvertexArena());
+		m_vertices->create(ZCONSOLE_WIDTH, ZCONSOLE_HEIGHT);
+
+		m_partition.clear();
+		while (m_partition.length() < ZCONSOLE_WIDTH - 2) {
+			m_partition += "-";
+		}
+		m_cursor.reset(new Zcursor(this));
+	    m_history.reset(new Zhistory(this)); 
+		m_logtable.reset(new ZlogTable());
+		m_screen.reset(new Zscreen(this));
+		m_commandtable.reset(new ZcommandTable(this));     
+		m_renderer.reset(new Zrenderer(this));
+	   
+	    m_cursor->initialize();
+	    m_history->initialize(_directory); 
+		m_directory = _directory;
+		m_screen->initialize();
+		m_commandtable->initialize();
+		m_renderer->initialize();
+
+	    parseLastLine(false); 
+		initialized = true;
+	} 
+	return initialized;
+} 
+
+
+void Zconsole::release() {
+	m_history->save(false);
+	m_screen.reset();
+	m_cursor.reset();
+	m_history.reset();
+	m_commandtable.reset();	 
+	m_glyphtable.reset();
+	m_renderer.reset();
+	m_vertices.reset();
+	m_logtable.reset();
+
+	//producers may still be posting, the queues stay and are emptied
+	m_printqueue->drain([](const char*, unsigned int) {});
+	m_threadlog->collect([](unsigned int, const char*, unsigned int) {});
+} 
+
+
+bool Zconsole::insertCommand(const zcommand& _command) {
+	return m_commandtable->insert(_command);
+}  
+
+
+bool Zconsole::removeCommand(const zcommand& _command) {
+	return m_commandtable->remove(_command);
+}
+
+
+void Zconsole::print(zstrview _string) {
+	m_screen->echoLine(_string);
+}
+
+
+bool Zconsole::post(zstrview _string) {
+	return m_printqueue->push(_string);
+}
+
+
+unsigned int Zconsole::getDroppedCount() const {
+	return m_printqueue->getDroppedCount();
+}
+
+
+bool Zconsole::postLocal(zstrview _string) {
+	return m_threadlog->push(_string);
+}
+
+
+void Zconsole::printLines(const zstring* _lines, unsigned int _count) {
+	m_screen->echoLines(_lines, _count);
+}
+
+
+void Zconsole::printLines(const zstrings& _lines) {
+	if (!_lines.empty())
+		m_screen->echoLines(&_lines[0], (unsigned int)_lines.size());
+}
+
+
+void Zconsole::printBlock(zstrview _block) {
+	m_screen->echoBlock(_block);
+}
+
+
+void Zconsole::setDirectory(const zstring& _directory) {
+	m_history->setDirectory(_directory);
+	m_directory = _directory;
+}
+
+
+const sf::Font* const Zconsole::getFont() const {
+	if (!m_font) 
+		loadFont();
+	return m_font.get();
+}
+
+
+bool Zconsole::setFont(const zstring& _filename) {
+	std::unique_ptr<sf::Font> font(new sf::Font());
+	if (!font->loadFromFile(_filename) || 
+		!Zconsole_IsMonospaceFont(*font, m_charsize))
+		return false;
+
+	std::swap(m_font, font);
+	const zstring fontfile = m_fontfile;
+	m_fontfile = _filename;
+
+	if (!rebuildGlyphs()) {
+		//the previous font keeps working
+		std::swap(m_font, font);
+		m_fontfile = fontfile;
+		rebuildGlyphs();
+		return false;
+	}
+	//the cell grid atlas is built from the glyph table
+	if (!m_renderer->setMode(m_renderer->getMode()))
+		print("render mode is unavailable for this font, using vertex arrays");
+	m_layoutdirty = true;
+	++m_pendingUpdates;
+	return true;
+}
+
+
+bool Zconsole::setRenderMode(zrendermode _mode) {
+	const bool result = m_renderer->setMode(_mode);
+
+	//the selected backend needs the whole console rebuilt
+	m_layoutdirty = true;
+	++m_pendingUpdates;
+	return result;
+}
+
+
+zrendermode Zconsole::getRenderMode() const {
+	return m_renderer->getMode();
+}
+
+
+void Zconsole::setRenderCache(bool _enable) {
+	m_renderer->setCaching(_enable);
+}
+
+
+bool Zconsole::isRenderCacheValid() const {
+	//the cursor is drawn over the cached image, its blink counts too
+	return m_renderer->isCacheValid() && !m_cursor->hasChanged();
+}
+
+
+bool Zconsole::setScrollbackSpill(const zstring& _filepath) {
+	return m_screen->setSpill(_filepath);
+}
+
+
+void Zconsole::setScrollbackMaxBytes(unsigned long long _bytes) {
+	m_screen->setMaxBytes(_bytes);
+}
+
+
+unsigned long long Zconsole::getScrollbackBytes() const {
+	return m_screen->getScrollback().getBytesHeld();
+}
+
+
+void Zconsole::open() {  
+	m_entrykeyflag = true;  
+	m_isOpenFlag   = true;  
+	
+	m_screen->clear(); 
+	print(getVersion());
+	print("(C) 2015-2021 Zachary T Harris. All rights reserved.");
+	print(" ");
+}  
+
+
+void Zconsole::close() { 
+	 m_screen->clear(); 
+	 m_isOpenFlag = false;  
+}  
+
+
+void Zconsole::onEvent(const sf::Event& _event) {   
+	if (!m_isOpenFlag) {
+		return;
+	}
+	if (m_entrykeyflag) {
+		if (!sf::Keyboard::isKeyPressed(ZCONSOLE_ENTRYKEY))
+			m_entrykeyflag = false;
+		return;
+	} 
+	switch (_event.type) {
+	case sf::Event::TextEntered:
+		m_cursor->addChar((char)(_event.text.unicode));
+		break;
+
+	case sf::Event::KeyPressed:
+		if (_event.key.control) {
+			switch (_event.key.code) {
+			case sf::Keyboard::Left:
+				m_cursor->moveOneWord(-1);
+				break;
+			case sf::Keyboard::Right:
+				m_cursor->moveOneWord(+1);
+				break;
+			case sf::Keyboard::Up:
+				m_screen->scroll(-1);
+				break;
+			case sf::Keyboard::Down: 
+				m_screen->scroll(1);
+				break;
+			case sf::Keyboard::Home:  
+				m_screen->scroll(ZCONSOLE_SCROLLBEGIN);
+				break;
+			case sf::Keyboard::End:  
+				m_screen->scroll(ZCONSOLE_SCROLLEND);
+				break;
+			case sf::Keyboard::PageDown:
+				m_screen->scroll(ZCONSOLE_HEIGHT - 3);
+				break;
+			case sf::Keyboard::PageUp: 
+				m_screen->scroll(-(ZCONSOLE_HEIGHT - 3));
+				break; 
+			}
+		}
+		else {
+			switch (_event.key.code) {
+			case sf::Keyboard::Backspace:
+				m_cursor->backspace();
+				break;
+			case sf::Keyboard::Delete:
+				m_cursor->erase();
+				break;
+			case sf::Keyboard::Enter:
+				parseLastLine(1);
+				break;
+			case sf::Keyboard::Left:
+				m_cursor->move(-1);
+				break;
+			case sf::Keyboard::Right: 
+				m_cursor->move(1);
+				break;
+			case sf::Keyboard::End:  
+				m_cursor->move(ZCONSOLE_CURSOREND);
+				break;
+			case sf::Keyboard::Home: 
+				m_cursor->move(ZCONSOLE_CURSORHOME);
+				break;
+			case sf::Keyboard::Up:      
+				scrollHistory(-1);
+				break;
+			case sf::Keyboard::Down:   
+				scrollHistory(1);
+				break;
+			case sf::Keyboard::F3:
+				m_screen->find(zstring(), _event.key.shift);
+				break;
+			case sf::Keyboard::Escape:  
+				close();
+				return; 
+			}
+		} 
+	}  
+} 
+
+
+void Zconsole::onPresent(
+	sf::RenderTarget& _rendertarget,
+	sf::RenderStates  _renderstates) {
+
+	if (!m_isOpenFlag) {
+		return;
+	}
+	const auto& originalview = _rendertarget.getView();
+
+	{//the scale the host draws with, picked up by the next update
+		const float* matrix = _renderstates.transform.getMatrix();
+		m_hostscale = std::max(
+			std::sqrt(matrix[0] * matrix[0] + matrix[1] * matrix[1]),
+			std::sqrt(matrix[4] * matrix[4] + matrix[5] * matrix[5]));
+	}
+	_renderstates.texture = &m_glyphtable->getTexture();
+
+	auto transform = sf::Transform::Identity;
+	transform.scale(getLayoutScale(), getLayoutScale());
+	_renderstates.transform *= transform;
+
+	const auto size = _rendertarget.getSize();
+	const auto rect = 
+		sf::FloatRect(
+			-15.f, -10.f, 
+			(float)size.x, (float)size.y);
+
+	_rendertarget.setView(sf::View(rect));
+	m_renderer->present(_rendertarget, _renderstates);
+
+	//drawn on top, so blinking never invalidates the console itself
+	m_cursor->draw(_rendertarget, _renderstates);
+
+	_rendertarget.setView(originalview);
+}
+
+
+bool Zconsole::onUpdate(float _delta) {    
+	pollInput();
+	m_cursor->update();	 
+	updateCharacterSize();
+	m_screen->echoQueue(*m_printqueue);
+	m_screen->echoThreads(*m_threadlog);
+	m_screen->updateFilter();
+	 
+	static unsigned int lastpendingupdates = 0;
+	static int          lastcursoroffset   = -1;
+	if (!m_glyphtable ||
+		lastpendingupdates == m_pendingUpdates) {
+		return m_isOpenFlag;
+	} 
+	lastpendingupdates = m_pendingUpdates;  
+	m_screen->update();
+	/*--------------------------------------------*/ 
+	/*--------------------------------------------*/ 
+	
+	
+	 
+	//the vertex layout is fixed: [background | frame | text],
+	//the static part is built once and only changed text rows get patched
+
+	//the cell grid backend only needs the changed rows as texels 
+	const bool cellgrid = 
+		m_renderer->getMode() == ZRENDER_CELLGRID;
+
+	if (m_layoutdirty) {
+		m_layoutdirty = false;
+		m_screen->invalidate();
+		if (!cellgrid)
+			rebuildFrame();
+	}
+	const int cursoroffset = 
+		(int)(m_cursor->getPosition() - m_lastlineOffset);
+
+	const bool promptchanged = 
+		m_screen->isRowDirty(ZCONSOLE_HEIGHT - 2) ||
+		cursoroffset != lastcursoroffset;
+
+	if (cellgrid) {
+		for (unsigned int row = 0; row < ZCONSOLE_HEIGHT; ++row) {
+			if (m_screen->isRowDirty(row))
+				m_renderer->updateCells(row);
+		}
+		if (promptchanged) {
+			const auto pen = m_renderer->getCellPosition(
+				cursoroffset, ZCONSOLE_HEIGHT - 2);
+			m_cursor->reset(pen.x, pen.y);
+		}
+	}
+	else {
+		for (unsigned int row = 1; row < ZCONSOLE_HEIGHT - 1; ++row) {
+			if (m_screen->isRowDirty(row))
+				rebuildRow(row);
+			else if (row == ZCONSOLE_HEIGHT - 2 && promptchanged)
+				rebuildRow(row);
+		}
+	}
+	m_screen->clearDirtyRows();
+	lastcursoroffset = cursoroffset;
+	return m_isOpenFlag;
+} 
+
+
+float Zconsole::writeGlyph(
+	sf::Vertex*  _quad,
+	unsigned int _char,
+	unsigned int _color,
+	float        _xoffset,
+	float        _yoffset) {
+
+	int   ix, iy, ir, ib;
+	float px, py, pr, pb; 
+
+	/*Handle spaces, collapse the quad so the slot draws nothing*/
+	switch (_char) {
+	case '\t': case '\n': case ' ':
+		for (unsigned int n = 0; n < 6; ++n) {
+			_quad[n] = sf::Vertex(
+				{ _xoffset, _yoffset }, sf::Color::Transparent);
+		}
+		return m_glyphtable->getGlyph(L' ').advance;
+	} 
+	/*Extract the current glyph's description*/
+	const sf::Glyph& glyph = m_glyphtable->getGlyph(_char);
+
+	ix = (int)(floor(glyph.bounds.left) + _xoffset);
+	iy = (int)(floor(glyph.bounds.top) + _yoffset);
+	ir = (int)(ceil(glyph.bounds.left + glyph.bounds.width) + _xoffset);
+	ib = (int)(ceil(glyph.bounds.top + glyph.bounds.height) + _yoffset);
+
+	px = (float)ix;
+	py = (float)iy;
+	pr = (float)ir;
+	pb = (float)ib;
+
+	const float ux = (float)(glyph.textureRect.left);
+	const float uy = (float)(glyph.textureRect.top);
+	const float ur = (float)(ux + glyph.textureRect.width);
+	const float ub = (float)(uy + glyph.textureRect.height);
+
+	{/*Write the quad for the current character into its slot*/
+		const sf::Color col = Zconsole_GetColorFromUint(_color);
+
+	    _quad[0] = sf::Vertex({ px, py }, col, { ux, uy });
+	    _quad[1] = sf::Vertex({ pr, py }, col, { ur, uy });
+	    _quad[2] = sf::Vertex({ px, pb }, col, { ux, ub });
+	    _quad[3] = sf::Vertex({ px, pb }, col, { ux, ub });
+	    _quad[4] = sf::Vertex({ pr, py }, col, { ur, uy });
+	    _quad[5] = sf::Vertex({ pr, pb }, col, { ur, ub });
+	}													   
+	return glyph.advance;
+} 
+
+
+bool Zconsole::loadFont() const {
+	m_font.reset(new sf::Font());
+	if (!m_fontfile.empty())
+		return m_font->loadFromFile(m_fontfile);
+	return m_font->loadFromMemory(
+		s_zconsole_fontdata, 
+		sizeof(s_zconsole_fontdata));
+}
+
+
+bool Zconsole::rebuildGlyphs() {
+	//the builtin font at the baked size needs no rasterizing at all
+	if (m_fontfile.empty() && m_charsize == ZFONTATLAS_CHARSIZE) 
+		return m_glyphtable->rebuild();
+	if (!m_font)
+		loadFont();
+	return m_glyphtable->rebuild(*m_font, m_charsize);
+}
+
+
+void Zconsole::updateCharacterSize() {
+	//rasterize at the size glyphs actually end up on screen
+	const unsigned int charsize = Zconsole_GetCharacterSize(
+		ZCONSOLE_FONTSIZE * m_renderscale * m_hostscale);
+
+	if (!m_glyphtable || 
+		charsize == m_charsize || charsize == m_charsizefailed) 
+		return;
+	const unsigned int previous = m_charsize;
+	m_charsize = charsize;
+
+	//reloading drops the glyph pages of the previous size
+	if (m_font)
+		loadFont();
+	if (!rebuildGlyphs()) {
+		//stay at the last size that worked, and do not retry this one
+		m_charsizefailed = charsize;
+		m_charsize       = previous;
+		if (m_font)
+			loadFont();
+		rebuildGlyphs();
+		print("unable to rasterize the font at size {}", charsize);
+	}
+	//the cell grid atlas is built from the glyph table
+	const zrendermode mode = m_renderer->getMode();
+	if (!m_renderer->setMode(mode))
+		print("render mode is unavailable at this size, using vertex arrays");
+	m_layoutdirty = true;
+	++m_pendingUpdates;
+}
+
+
+float Zconsole::getLayoutScale() const {
+	//the layout is in units of the rasterized size, this brings
+	//it back to the size selected with the scale command
+	return m_renderscale * ZCONSOLE_FONTSIZE / m_charsize;
+}
+
+
+void Zconsole::rebuildFrame() {
+	float px, py, pr, pb; 
+
+	const auto* const cells = m_screen->getCellMatrix();
+
+	//the frame follows the background, one slot per border cell
+	sf::Vertex* vertices = m_vertices->getFrame(0);
+
+	//Precompute the variables needed by the algorithm
+	const auto& glyphs = *m_glyphtable;
+
+	float hspace  = glyphs.getGlyph(L' ').advance;
+	float vspace  = glyphs.getLineSpacing();
+
+	/*-----------------------------------------------------------------------*/ 
+	/*-----------------------------------------------------------------------*/
+	for (unsigned int y = 0; y < ZCONSOLE_HEIGHT; ++y) {
+		for (unsigned int x = 0; x < ZCONSOLE_WIDTH; ++x) {
+			if (y != 0 && y != ZCONSOLE_HEIGHT - 1 &&
+				x != 0 && x != ZCONSOLE_WIDTH - 1) {
+				continue;
+			}
+			const auto& cell = cells[x + ZCONSOLE_WIDTH * y];
+
+			writeGlyph(
+				vertices, 
+				cell.mchar, 
+				cell.color, 
+				hspace * x, 
+				m_charsize + (vspace * y));
+			vertices += 6;
+		}
+	}
+	/*-----------------------------------------------------------------------*/ 
+	/*-----------------------------------------------------------------------*/
+	{//fill the reserved background vertices, the frame encloses everything
+		const auto bounds = getFrameBounds();
+
+		sf::Vertex* const background = m_vertices->getBackground();
+
+		px = floor(bounds.left);
+		py = floor(bounds.top);
+		pr = ceil(bounds.left + bounds.width);
+		pb = ceil(bounds.top + bounds.height);
+		 
+		background[0] = sf::Vertex({ px, py }, sf::Color::Black, { 1.f, 1.f }); 
+		background[1] = sf::Vertex({ pr, py }, sf::Color::Black, { 1.f, 1.f }); 
+		background[2] = sf::Vertex({ px, pb }, sf::Color::Black, { 1.f, 1.f }); 
+		background[3] = sf::Vertex({ px, pb }, sf::Color::Black, { 1.f, 1.f }); 
+		background[4] = sf::Vertex({ pr, py }, sf::Color::Black, { 1.f, 1.f }); 
+		background[5] = sf::Vertex({ pr, pb }, sf::Color::Black, { 1.f, 1.f });  
+	} 
+	m_renderer->invalidate(0, m_vertices->getTextOffset(1));
+}
+
+
+sf::FloatRect Zconsole::getFrameBounds() const {
+	const auto* const cells  = m_screen->getCellMatrix();
+	const auto&       glyphs = *m_glyphtable;
+
+	//every edge holds two corners and one repeated bar, so the box
+	//follows from the grid size and the metrics of those glyphs alone
+	const unsigned int ul = 0;
+	const unsigned int ur = ZCONSOLE_WIDTH - 1;
+	const unsigned int bl = ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 1);
+	const unsigned int br = ZCONSOLE_WIDTH * ZCONSOLE_HEIGHT - 1;
+
+	const auto edge = [&](
+		unsigned int _a, 
+		unsigned int _b, 
+		unsigned int _c, 
+		bool         _maximum, 
+		bool         _vertical) {
+
+		float result = 0.f;
+		const unsigned int sample[3] = { _a, _b, _c };
+		for (unsigned int it = 0; it < 3; ++it) {
+			const auto& rect = 
+				glyphs.getGlyph(cells[sample[it]].mchar).bounds;
+
+			const float origin = _vertical ? rect.top    : rect.left;
+			const float extent = _vertical ? rect.height : rect.width;
+			const float value  = _maximum ? origin + extent : origin;
+			if (it == 0 || (_maximum ? value > result : value < result))
+				result = value;
+		}
+		return result;
+	};
+	const float hspace = glyphs.getGlyph(L' ').advance;
+	const float vspace = glyphs.getLineSpacing();
+
+	const float px = edge(ul, ul + ZCONSOLE_WIDTH, bl, false, false);
+	const float py = edge(ul, ul + 1, ur, false, true) + m_charsize;
+	const float pr = edge(ur, ur + ZCONSOLE_WIDTH, br, true, false) + 
+		hspace * (ZCONSOLE_WIDTH - 1);
+	const float pb = edge(bl, bl + 1, br, true, true) + 
+		vspace * (ZCONSOLE_HEIGHT - 1) + m_charsize;
+
+	return sf::FloatRect(px, py, pr - px, pb - py);
+}
+
+
+void Zconsole::rebuildRow(unsigned int _row) {
+	const auto* const cells = 
+		m_screen->getCellMatrix() + (_row * ZCONSOLE_WIDTH);
+
+	//each interior cell owns 6 vertices(2 triangles) in the text batch
+	sf::Vertex* vertices = m_vertices->getText(1, _row);
+	m_renderer->invalidate(
+		m_vertices->getTextOffset(_row), 
+		m_vertices->getTextRowSize());
+
+	//Precompute the variables needed by the algorithm
+	const auto& glyphs = *m_glyphtable;
+
+	float hspace  = glyphs.getGlyph(L' ').advance;
+	float vspace  = glyphs.getLineSpacing();
+	float xoffset = hspace;					  
+	float yoffset = m_charsize + (vspace * _row); 
+
+	unsigned int prevChar = cells[0].mchar;  
+
+	//the cursor only ever lives on the prompt line
+	const int cursorcolumn = 
+		(_row == ZCONSOLE_HEIGHT - 2) ?
+		(int)(m_cursor->getPosition() - m_lastlineOffset) : -1;
+
+	 
+	/*-----------------------------------------------------------------------*/ 
+	/*-----------------------------------------------------------------------*/
+	for (unsigned int A = 1; A < ZCONSOLE_WIDTH - 1; ++A, vertices += 6) {
+		unsigned int curChar = cells[A].mchar; 
+
+		/*Apply the kerning offset*/
+		xoffset += glyphs.getKerning(prevChar, curChar); 
+
+		prevChar = curChar; 
+	
+	    /*add a cursor under the glyph if this is the right position*/		 
+		if (cursorcolumn == (int)A) { 
+			m_cursor->reset(xoffset, yoffset); 
+		}
+		/*Write the glyph and advance to the next character*/
+		xoffset += writeGlyph(
+			vertices, curChar, cells[A].color, xoffset, yoffset);
+	}   
+} 
+
+
+void Zconsole::processNextCommand() { 
+	size_t   comment;
+	zstrings commandList;
+	zstring  cmd, argString;
+
+	if (m_commandbuffer.empty()) {
+		return;
+	}
+	/*
+	Allow commands in quotes as single String:
+	-----------------------------------------*/
+	comment = m_commandbuffer.find_first_of('"');
+
+	if (comment != zstring::npos) {
+		cmd = m_commandbuffer.substr(0u, comment);
+		argString = m_commandbuffer.substr(
+			m_commandbuffer.find_first_of('"'),
+			m_commandbuffer.find_last_of('"'));
+	}
+	else { cmd = m_commandbuffer; }
+	
+	/*
+	Remove prompt characters:
+	-----------------------------------------*/
+	for (unsigned int i = 0; i < zstring(ZCONSOLE_PROMPT).size(); ++i) {
+		cmd.erase(cmd.begin());
+	} 
+	/*
+	Split into command and arguments:
+	-----------------------------------------*/
+	commandList = Zconsole_TokenizeString(cmd, ' ');
+	if (!commandList.empty()) {
+		commandList[0] = 
+			Zconsole_StringToLower(commandList[0]);
+		commandList.push_back(argString);
+		m_commandtable->run(commandList);
+	}
+} 
+
+ 
+void Zconsole::parseLastLine(bool _isCommandEntry) {
+	print(m_lastline);
+	m_history->update();
+
+	m_commandbuffer += m_lastline;
+
+	if (_isCommandEntry) {
+		processNextCommand();
+	}
+	m_commandbuffer.clear();
+	m_lastline.clear();
+	m_cursor->setPosition(1);
+	m_lastlineOffset = 0;
+	++m_pendingUpdates;
+	/*
+	Reset prompt:*/
+	m_lastline += zstring(ZCONSOLE_PROMPT);
+	m_cursor->moveOneWord(-1);
+} 
+
+
+void Zconsole::pollInput() { 
+	static ZtimedInputKey kbackspace(sf::Keyboard::BackSpace);
+	static ZtimedInputKey kscrollup(sf::Keyboard::Up);
+	static ZtimedInputKey kscrolldown(sf::Keyboard::Down);
+
+	if (kbackspace.isPressed())
+		m_cursor->backspace();
+	else {
+		if (sf::Keyboard::isKeyPressed(sf::Keyboard::LControl)) {
+			if (kscrollup.isPressed())
+				m_screen->scroll(-1);
+			else if (kscrolldown.isPressed())
+				m_screen->scroll(+1);
+		}
+	}
+}
+
+
+void Zconsole::scrollHistory(int _direction) {
+	m_history->read(_direction);
+	m_lastlineOffset = 0;
+	m_cursor->move(ZCONSOLE_CURSOREND);
+	++m_pendingUpdates;
+}
+
+
+void Zconsole::logRecord(
+	zstrview             _format, 
+	zlogdecoder          _decoder, 
+	const unsigned char* _args, 
+	unsigned int         _size) {
+
+	const unsigned int site = m_logtable->getSite(_format, _decoder);
+	if (site < ZCONSOLE_LOGSITES) {
+		m_screen->echoLog(site, _args, _size);
+		return;
+	}
+	//no room left for another site, the line is formatted right away
+	zformat line;
+	_decoder(line, _format, _args);
+	print(zstrview(line.text, line.size));
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/ 
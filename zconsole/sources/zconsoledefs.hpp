@@ -1,51 +1,70 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: zconsoledefs.hpp
-* Desc: common global console constants
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/  
-#ifndef __ZCONSOLEDEFS_HPP__
-#define	__ZCONSOLEDEFS_HPP__
-
-#define ZCONSOLE_PROMPT         ">: "  
-#define ZCONSOLE_WIDTH          80
-#define ZCONSOLE_HEIGHT         25
-#define ZCONSOLE_FONTSIZE       64
-#define ZCONSOLE_HISTORYSIZE    100 
-#define ZCONSOLE_TEXTCOLOR      0x783C00FFU
-#define ZCONSOLE_MAXMSGSAVE     0x00000BB8U 
-#define ZCONSOLE_DEFAULTSCALE   0.25f
-#define ZCONSOLE_MAXLINES       (ZCONSOLE_HEIGHT - 2) 
-#define ZCONSOLE_MAXECHOS       (ZCONSOLE_MAXLINES - 3) 
-#define ZCONSOLE_TOTALSIZE      (ZCONSOLE_WIDTH * ZCONSOLE_HEIGHT) 
-#define ZCONSOLE_ENTRYKEY       sf::Keyboard::Tilde 
-#define ZCONSOLE_CURSORBLINK    350 
-#define ZCONSOLE_CURSOREND      0x000186A0 
-#define ZCONSOLE_CURSORGLYPH    0x00002588 
-#define ZCONSOLE_CURSORHOME    -0x000186A0  
-#define ZCONSOLE_CURSORMINX     0x00000004 
-#define ZCONSOLE_SCROLLBEGIN   -0x3B9ACA00  
-#define ZCONSOLE_SCROLLEND      0x3B9ACA00  
-
-/*****************************************************************************/  
-#endif //EOF
-/*****************************************************************************/  
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zconsoledefs.hpp
+* Desc: common global console constants
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/  
+#ifndef __ZCONSOLEDEFS_HPP__
+#define	__ZCONSOLEDEFS_HPP__
+
+#define ZCONSOLE_PROMPT         ">: "  
+#define ZCONSOLE_WIDTH          80
+#define ZCONSOLE_HEIGHT         25
+#define ZCONSOLE_FONTSIZE       64
+#define ZCONSOLE_FONTSIZEMIN    12
+#define ZCONSOLE_FONTSIZEMAX    128
+#define ZCONSOLE_HISTORYSIZE    100 
+#define ZCONSOLE_TEXTCOLOR      0x783C00FFU
+#define ZCONSOLE_MAXMSGSAVE     0x00000BB8U 
+#define ZCONSOLE_SCROLLBACKSIZE 0x00200000U 
+#define ZCONSOLE_RETAINSIZE     0x00600000U 
+#define ZCONSOLE_COLDBLOCKSIZE  0x00010000U 
+#define ZCONSOLE_COLDCACHE      4 
+#define ZCONSOLE_FILTERBATCH    0x00001000U 
+#define ZCONSOLE_FILTERCHARS    0x00000400U 
+#define ZCONSOLE_LOGSITES       0x00001000U 
+#define ZCONSOLE_LOGCACHE       64 
+#define ZCONSOLE_LOGRECORD      0xFFFFFFFFU 
+#define ZCONSOLE_QUEUESIZE      0x00000400U 
+#define ZCONSOLE_QUEUELINE      248 
+#define ZCONSOLE_THREADBUFFER   0x00010000U 
+#define ZCONSOLE_THREADSKIP     0xFFFFFFFFU 
+#define ZCONSOLE_DEFAULTSCALE   0.25f
+#define ZCONSOLE_MAXLINES       (ZCONSOLE_HEIGHT - 2) 
+#define ZCONSOLE_MAXECHOS       (ZCONSOLE_MAXLINES - 3) 
+#define ZCONSOLE_TOTALSIZE      (ZCONSOLE_WIDTH * ZCONSOLE_HEIGHT) 
+#define ZCONSOLE_FRAMESIZE      (2 * (ZCONSOLE_WIDTH + ZCONSOLE_HEIGHT) - 4) 
+#define ZCONSOLE_ENTRYKEY       sf::Keyboard::Tilde 
+#define ZCONSOLE_CURSORBLINK    350 
+#define ZCONSOLE_CURSOREND      0x000186A0 
+#define ZCONSOLE_CURSORGLYPH    0x00002588 
+#define ZCONSOLE_GLYPHASCII     0x00000080 
+#define ZCONSOLE_GLYPHBOXMIN    0x00002500 
+#define ZCONSOLE_GLYPHBOXMAX    0x000025A0 
+#define ZCONSOLE_CURSORHOME    -0x000186A0  
+#define ZCONSOLE_CURSORMINX     0x00000004 
+#define ZCONSOLE_SCROLLBEGIN   -0x3B9ACA00  
+#define ZCONSOLE_SCROLLEND      0x3B9ACA00  
+
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -0,0 +1,314 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zfilter.cpp
+* Desc: background regex filter over console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#include <algorithm>
+#include "zconsoledefs.hpp"
+#include "zfilter.hpp"
+
+
+
+/* Section 1:
+** internal interface functions
+******************************************************************************/
+void Zconsole::Zfilter::run() {
+	std::vector<char>      text;
+	std::vector<BatchLine> lines;
+	std::vector<BatchLine> matches;
+	std::regex             regex;
+	unsigned int           generation = 0;
+	bool                   compiled   = false;
+
+	std::unique_lock<std::mutex> lock(m_mutex);
+	for (;;) {
+		m_signal.wait(lock, [this] { return m_quit || m_batchready; });
+		if (m_quit)
+			return;
+
+		//take the batch, the expression is only copied when it changed
+		text.swap(m_batchtext);
+		lines.swap(m_batchlines);
+		if (!compiled || generation != m_generation) {
+			regex      = m_regex;
+			generation = m_generation;
+			compiled   = true;
+		}
+		m_batchready = false;
+		lock.unlock();
+
+		matches.clear();
+		for (const auto& it : lines) {
+			const char* first = text.data() + it.offset;
+			try {
+				if (std::regex_search(first, first + it.size, regex))
+					matches.push_back(it);
+			}
+			catch (const std::regex_error&) {
+				//too complex for this line, it does not match
+			}
+		}
+
+		lock.lock();
+		m_results.swap(matches);
+		m_resultgen   = generation;
+		m_resultready = true;
+	}
+}
+
+
+bool Zconsole::Zfilter::dropEvicted(const Zscrollback& _scrollback) {
+	const unsigned int base  = _scrollback.getRowBase();
+	const unsigned int count = _scrollback.getRowCount();
+
+	bool changed = false;
+	while (!m_view.empty() && m_view.front().first - base >= count) {
+		m_view.pop_front();
+		changed = true;
+	}
+	if (m_nextrow - base > count)
+		m_nextrow = base;
+	return changed;
+}
+
+
+
+
+
+/* Section 2:
+** public interface functions
+******************************************************************************/
+Zconsole::Zfilter::Zfilter() :
+	m_generation(0),
+	m_batchready(false),
+	m_resultgen(0),
+	m_resultready(false),
+	m_quit(false),
+	m_active(false),
+	m_busy(false),
+	m_nextrow(0),
+	m_viewend(0) {}
+
+
+Zconsole::Zfilter::~Zfilter() {
+	if (m_thread.joinable()) {
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_quit = true;
+		}
+		m_signal.notify_one();
+		m_thread.join();
+	}
+}
+
+
+bool Zconsole::Zfilter::start(
+	const zstring&     _pattern, 
+	const Zscrollback& _scrollback) {
+
+	std::regex regex;
+	try {
+		regex.assign(_pattern, std::regex::ECMAScript | std::regex::icase);
+	}
+	catch (const std::regex_error&) {
+		return false;
+	}
+	{
+		//a batch not yet taken by the worker is withdrawn
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_regex = std::move(regex);
+		++m_generation;
+		if (m_batchready) {
+			m_batchready = false;
+			m_busy       = false;
+		}
+	}
+	if (!m_thread.joinable())
+		m_thread = std::thread(&Zfilter::run, this);
+
+	m_pattern = _pattern;
+	m_active  = true;
+	m_nextrow = _scrollback.getRowBase();
+	m_viewend = 0;
+	m_view.clear();
+	return true;
+}
+
+
+void Zconsole::Zfilter::stop() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		++m_generation;
+		if (m_batchready) {
+			m_batchready = false;
+			m_busy       = false;
+		}
+	}
+	m_active = false;
+	m_pattern.clear();
+	m_view.clear();
+	m_viewend = 0;
+}
+
+
+bool Zconsole::Zfilter::isActive() const {
+	return m_active;
+}
+
+
+const zstring& Zconsole::Zfilter::getPattern() const {
+	return m_pattern;
+}
+
+
+bool Zconsole::Zfilter::update(Zscrollback& _scrollback) {
+	if (!m_active)
+		return false;
+
+	bool changed = dropEvicted(_scrollback);
+
+	/*
+	Collect the results of the last batch, results of an 
+	older filter are thrown away:*/
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_resultready) {
+			m_resultready = false;
+			m_busy        = false;
+			if (m_resultgen == m_generation) {
+				for (const auto& it : m_results) {
+					ViewLine line;
+					line.first = it.first;
+					line.rows  = it.rows;
+					line.start = m_viewend;
+					m_view.push_back(line);
+					m_viewend += it.rows;
+				}
+				changed = !m_results.empty() || changed;
+			}
+		}
+	}
+	if (changed)
+		dropEvicted(_scrollback);
+	if (m_busy)
+		return changed;
+
+	/*
+	Hand out the next lines, on this thread since the scrollback
+	is not shared. Only text is copied, the view indexes rows:*/
+	const unsigned int base  = _scrollback.getRowBase();
+	const unsigned int count = _scrollback.getRowCount();
+
+	m_scratchtext.clear();
+	m_scratchlines.clear();
+
+	Zscrollback::Line line;
+	while (m_scratchlines.size() < ZCONSOLE_FILTERBATCH && 
+		   m_nextrow - base < count &&
+		   _scrollback.getLine(m_nextrow, line)) {
+
+		/*
+		The matcher recurses about once per character and would run
+		past the stack of the worker on long lines, so it only ever
+		sees the start of a line:*/
+		BatchLine batch;
+		batch.first  = line.first;
+		batch.rows   = line.rows;
+		batch.offset = (unsigned int)m_scratchtext.size();
+		batch.size   = std::min(line.size, ZCONSOLE_FILTERCHARS);
+		m_scratchtext.insert(
+			m_scratchtext.end(), line.text, line.text + batch.size);
+		m_scratchlines.push_back(batch);
+		m_nextrow = line.first + line.rows;
+	}
+	if (m_scratchlines.empty())
+		return changed;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_batchtext.swap(m_scratchtext);
+		m_batchlines.swap(m_scratchlines);
+		m_batchready = true;
+		m_busy       = true;
+	}
+	m_signal.notify_one();
+	return changed;
+}
+
+
+unsigned int Zconsole::Zfilter::getRowCount() const {
+	if (m_view.empty())
+		return 0;
+	return m_viewend - m_view.front().start;
+}
+
+
+unsigned int Zconsole::Zfilter::getRow(unsigned int _viewrow) const {
+	const unsigned int start = m_view.front().start + _viewrow;
+
+	unsigned int lo = 0;
+	unsigned int hi = m_view.size();
+	while (hi - lo > 1) {
+		const unsigned int mid = lo + (hi - lo) / 2;
+		if (m_view[mid].start <= start)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	const ViewLine& line = m_view[lo];
+	return line.first + (start - line.start);
+}
+
+
+bool Zconsole::Zfilter::getViewRow(
+	unsigned int  _row, 
+	unsigned int& _viewrow) const {
+
+	if (m_view.empty())
+		return false;
+
+	const unsigned int base = m_view.front().first;
+
+	unsigned int lo = 0;
+	unsigned int hi = m_view.size();
+	while (hi - lo > 1) {
+		const unsigned int mid = lo + (hi - lo) / 2;
+		if (m_view[mid].first - base <= _row - base)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	const ViewLine& line = m_view[lo];
+	if (_row - line.first >= line.rows)
+		return false;
+
+	_viewrow = (line.start - m_view.front().start) + (_row - line.first);
+	return true;
+}
+
+
+unsigned int Zconsole::Zfilter::getLineCount() const {
+	return m_view.size();
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
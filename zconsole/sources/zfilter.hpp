@@ -0,0 +1,137 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zfilter.hpp
+* Desc: background regex filter over console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#ifndef __ZFILTER_HPP__
+#define __ZFILTER_HPP__
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <regex>
+#include <thread>
+#include "zscrollback.hpp"
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::Zfilter final : sf::NonCopyable {
+public: 
+	Zfilter();
+	~Zfilter();	
+
+	/*
+	Start filtering the scrollback, any previous filter is replaced.
+	Lines are matched on a worker thread, the view fills up as 
+	results come in. Only the first ZCONSOLE_FILTERCHARS characters
+	of a line are matched.
+	@_pattern   : the regular expression lines must match (case is ignored)
+	@_scrollback: the scrollback to filter
+	@return     : true on success, false if the expression is invalid*/
+	bool start(const zstring& _pattern, const Zscrollback& _scrollback);
+
+	/*
+	Stop filtering, the view is emptied*/
+	void stop();
+
+	/*
+	Returns true while a filter is set*/
+	bool isActive() const;
+
+	/*
+	Returns the expression of the current filter*/
+	const zstring& getPattern() const;
+
+	/*
+	Collect the lines the worker matched and hand it the next batch 
+	of lines, never waits for the worker. Call this once per frame.
+	@_scrollback: the scrollback being filtered
+	@return     : true if the view changed*/
+	bool update(Zscrollback& _scrollback);
+
+	/*
+	Returns the number of wrapped rows in the view*/
+	unsigned int getRowCount() const;
+
+	/*
+	Returns the scrollback row shown at a row of the view.
+	@_viewrow: the row of the view, [0, getRowCount())
+	@return  : the row number, as Zscrollback::getRowBase()*/
+	unsigned int getRow(unsigned int _viewrow) const;
+
+	/*
+	Find where a scrollback row is shown in the view.
+	@_row    : the row number, as Zscrollback::getRowBase()
+	@_viewrow: receives the row of the view
+	@return  : true if the row is in the view, else false*/
+	bool getViewRow(unsigned int _row, unsigned int& _viewrow) const;
+
+	/*
+	Returns the number of lines matched so far*/
+	unsigned int getLineCount() const;
+
+private:
+	/*
+	A matching line, an index into the scrollback*/
+	struct ViewLine {
+		unsigned int first; //row number of the first row of the line
+		unsigned int rows;  //number of wrapped rows
+		unsigned int start; //view row of the first row, since the filter started
+	};
+	/*
+	A line handed to the worker, its text is in the batch buffer*/
+	struct BatchLine {
+		unsigned int first;  //row number of the first row of the line
+		unsigned int rows;   //number of wrapped rows
+		unsigned int offset; //offset of the text in the batch buffer
+		unsigned int size;   //number of characters
+	};
+
+	void run();
+	bool dropEvicted(const Zscrollback& _scrollback);
+
+	std::thread                m_thread;      //worker, started with the first filter
+	std::mutex                 m_mutex;       //guards the members up to m_quit
+	std::condition_variable    m_signal;      //wakes the worker
+	std::regex                 m_regex;       //expression of the next batch
+	unsigned int               m_generation;  //bumped by every new filter
+	std::vector<char>          m_batchtext;   //text of the lines to match
+	std::vector<BatchLine>     m_batchlines;  //lines to match
+	bool                       m_batchready;  //a batch waits for the worker
+	std::vector<BatchLine>     m_results;     //lines matched by the worker
+	unsigned int               m_resultgen;   //generation of the results
+	bool                       m_resultready; //results wait to be collected
+	bool                       m_quit;        //tells the worker to exit
+	bool                       m_active;      //true while a filter is set
+	bool                       m_busy;        //a batch is out with the worker
+	zstring                    m_pattern;     //expression of the current filter
+	unsigned int               m_nextrow;     //first row of the next line to hand out
+	std::deque<ViewLine>       m_view;        //matching lines, oldest first
+	unsigned int               m_viewend;     //view row after the last line
+	std::vector<char>          m_scratchtext; //batch being built
+	std::vector<BatchLine>     m_scratchlines;
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
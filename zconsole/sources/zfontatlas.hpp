@@ -0,0 +1,2151 @@
+#pragma once
+//generated by tools/zfontbake from zfontdata.hpp, do not edit
+#define ZFONTATLAS_CHARSIZE    16
+#define ZFONTATLAS_WIDTH       256
+#define ZFONTATLAS_HEIGHT      115
+#define ZFONTATLAS_LINESPACING 16.000000f
+#define ZFONTATLAS_GLYPHCOUNT  288
+
+struct zfontatlasglyph {
+	float advance;       //horizontal advance
+	int   left, top;     //offset of the bitmap from the pen
+	int   width, height; //size of the bitmap
+	int   u, v;          //position of the bitmap in the atlas
+};
+
+static constexpr zfontatlasglyph s_zconsole_atlasglyphs[288] =
+{
+    {   9.00f,   0,    0,   0,   0,    4,    0 }, // U+0000
+    {   9.00f,   0,  -10,   8,  10,    6,    0 }, // U+0001
+    {   9.00f,   0,  -10,   8,  10,   16,    0 }, // U+0002
+    {   9.00f,   0,   -8,   7,   8,   26,    0 }, // U+0003
+    {   9.00f,   0,   -8,   7,   7,   35,    0 }, // U+0004
+    {   9.00f,   0,   -9,   8,   9,   44,    0 }, // U+0005
+    {   9.00f,   0,   -9,   8,   9,   54,    0 }, // U+0006
+    {   9.00f,   2,   -6,   4,   4,   64,    0 }, // U+0007
+    {   9.00f,   0,  -12,   8,  16,   70,    0 }, // U+0008
+    {   9.00f,   1,   -7,   6,   6,   80,    0 }, // U+0009
+    {   9.00f,   0,  -12,   8,  16,   88,    0 }, // U+000A
+    {   9.00f,   0,  -10,   7,  10,   98,    0 }, // U+000B
+    {   9.00f,   0,  -10,   6,  10,  107,    0 }, // U+000C
+    {   9.00f,   0,  -10,   8,  10,  115,    0 }, // U+000D
+    {   9.00f,   0,  -10,   8,  10,  125,    0 }, // U+000E
+    {   9.00f,   0,   -9,   8,   9,  135,    0 }, // U+000F
+    {   9.00f,   0,  -11,   7,  11,  145,    0 }, // U+0010
+    {   9.00f,   0,  -11,   7,  11,  154,    0 }, // U+0011
+    {   9.00f,   1,  -10,   6,   9,  163,    0 }, // U+0012
+    {   9.00f,   1,  -10,   6,  10,  171,    0 }, // U+0013
+    {   9.00f,   0,  -10,   8,  10,  179,    0 }, // U+0014
+    {   9.00f,   0,  -11,   7,  12,  189,    0 }, // U+0015
+    {   9.00f,   0,   -4,   7,   4,  198,    0 }, // U+0016
+    {   9.00f,   1,  -10,   6,  10,  207,    0 }, // U+0017
+    {   9.00f,   1,  -10,   6,  10,  215,    0 }, // U+0018
+    {   9.00f,   1,  -10,   6,  10,  223,    0 }, // U+0019
+    {   9.00f,   0,   -7,   7,   5,  231,    0 }, // U+001A
+    {   9.00f,   0,   -7,   7,   5,  240,    0 }, // U+001B
+    {   9.00f,   0,   -6,   7,   4,    0,   18 }, // U+001C
+    {   9.00f,   0,   -7,   7,   5,    9,   18 }, // U+001D
+    {   9.00f,   0,   -8,   7,   7,   18,   18 }, // U+001E
+    {   9.00f,   0,   -8,   7,   7,   27,   18 }, // U+001F
+    {   9.00f,   0,    0,   0,   0,   36,   18 }, // U+0020
+    {   9.00f,   2,  -10,   4,  10,   38,   18 }, // U+0021
+    {   9.00f,   1,  -11,   6,   4,   44,   18 }, // U+0022
+    {   9.00f,   0,   -9,   7,   9,   52,   18 }, // U+0023
+    {   9.00f,   0,  -12,   7,  14,   61,   18 }, // U+0024
+    {   9.00f,   0,   -8,   7,   8,   70,   18 }, // U+0025
+    {   9.00f,   0,  -10,   7,  10,   79,   18 }, // U+0026
+    {   9.00f,   1,  -11,   3,   4,   88,   18 }, // U+0027
+    {   9.00f,   2,  -10,   4,  10,   93,   18 }, // U+0028
+    {   9.00f,   2,  -10,   4,  10,   99,   18 }, // U+0029
+    {   9.00f,   0,   -7,   8,   5,  105,   18 }, // U+002A
+    {   9.00f,   1,   -7,   6,   5,  115,   18 }, // U+002B
+    {   9.00f,   2,   -3,   3,   4,  123,   18 }, // U+002C
+    {   9.00f,   0,   -5,   7,   1,  128,   18 }, // U+002D
+    {   9.00f,   3,   -2,   2,   2,  137,   18 }, // U+002E
+    {   9.00f,   0,   -8,   7,   8,  141,   18 }, // U+002F
+    {   9.00f,   0,  -10,   7,  10,  150,   18 }, // U+0030
+    {   9.00f,   1,  -10,   6,  10,  159,   18 }, // U+0031
+    {   9.00f,   0,  -10,   7,  10,  167,   18 }, // U+0032
+    {   9.00f,   0,  -10,   7,  10,  176,   18 }, // U+0033
+    {   9.00f,   0,  -10,   7,  10,  185,   18 }, // U+0034
+    {   9.00f,   0,  -10,   7,  10,  194,   18 }, // U+0035
+    {   9.00f,   0,  -10,   7,  10,  203,   18 }, // U+0036
+    {   9.00f,   0,  -10,   7,  10,  212,   18 }, // U+0037
+    {   9.00f,   0,  -10,   7,  10,  221,   18 }, // U+0038
+    {   9.00f,   0,  -10,   7,  10,  230,   18 }, // U+0039
+    {   9.00f,   3,   -8,   2,   7,  239,   18 }, // U+003A
+    {   9.00f,   2,   -8,   3,   8,  243,   18 }, // U+003B
+    {   9.00f,   1,   -9,   6,   9,  248,   18 }, // U+003C
+    {   9.00f,   1,   -7,   6,   4,    0,   34 }, // U+003D
+    {   9.00f,   1,   -9,   6,   9,    8,   34 }, // U+003E
+    {   9.00f,   0,  -10,   7,  10,   16,   34 }, // U+003F
+    {   9.00f,   0,   -9,   7,   9,   25,   34 }, // U+0040
+    {   9.00f,   0,  -10,   7,  10,   34,   34 }, // U+0041
+    {   9.00f,   0,  -10,   7,  10,   43,   34 }, // U+0042
+    {   9.00f,   0,  -10,   7,  10,   52,   34 }, // U+0043
+    {   9.00f,   0,  -10,   7,  10,   61,   34 }, // U+0044
+    {   9.00f,   0,  -10,   7,  10,   70,   34 }, // U+0045
+    {   9.00f,   0,  -10,   7,  10,   79,   34 }, // U+0046
+    {   9.00f,   0,  -10,   7,  10,   88,   34 }, // U+0047
+    {   9.00f,   0,  -10,   7,  10,   97,   34 }, // U+0048
+    {   9.00f,   2,  -10,   4,  10,  106,   34 }, // U+0049
+    {   9.00f,   0,  -10,   7,  10,  112,   34 }, // U+004A
+    {   9.00f,   0,  -10,   7,  10,  121,   34 }, // U+004B
+    {   9.00f,   0,  -10,   7,  10,  130,   34 }, // U+004C
+    {   9.00f,   0,  -10,   7,  10,  139,   34 }, // U+004D
+    {   9.00f,   0,  -10,   7,  10,  148,   34 }, // U+004E
+    {   9.00f,   0,  -10,   7,  10,  157,   34 }, // U+004F
+    {   9.00f,   0,  -10,   7,  10,  166,   34 }, // U+0050
+    {   9.00f,   0,  -10,   7,  12,  175,   34 }, // U+0051
+    {   9.00f,   0,  -10,   7,  10,  184,   34 }, // U+0052
+    {   9.00f,   0,  -10,   7,  10,  193,   34 }, // U+0053
+    {   9.00f,   1,  -10,   6,  10,  202,   34 }, // U+0054
+    {   9.00f,   0,  -10,   7,  10,  210,   34 }, // U+0055
+    {   9.00f,   0,  -10,   7,  10,  219,   34 }, // U+0056
+    {   9.00f,   0,  -10,   7,  10,  228,   34 }, // U+0057
+    {   9.00f,   0,  -10,   7,  10,  237,   34 }, // U+0058
+    {   9.00f,   1,  -10,   6,  10,  246,   34 }, // U+0059
+    {   9.00f,   0,  -10,   7,  10,    0,   48 }, // U+005A
+    {   9.00f,   2,  -10,   4,  10,    9,   48 }, // U+005B
+    {   9.00f,   0,   -9,   7,   9,   15,   48 }, // U+005C
+    {   9.00f,   2,  -10,   4,  10,   24,   48 }, // U+005D
+    {   9.00f,   0,  -12,   7,   4,   30,   48 }, // U+005E
+    {   9.00f,   0,    1,   8,   1,   39,   48 }, // U+005F
+    {   9.00f,   2,  -11,   4,   3,   49,   48 }, // U+0060
+    {   9.00f,   0,   -7,   7,   7,   55,   48 }, // U+0061
+    {   9.00f,   0,  -10,   7,  10,   64,   48 }, // U+0062
+    {   9.00f,   0,   -7,   7,   7,   73,   48 }, // U+0063
+    {   9.00f,   0,  -10,   7,  10,   82,   48 }, // U+0064
+    {   9.00f,   0,   -7,   7,   7,   91,   48 }, // U+0065
+    {   9.00f,   1,  -10,   6,  10,  100,   48 }, // U+0066
+    {   9.00f,   0,   -7,   7,  10,  108,   48 }, // U+0067
+    {   9.00f,   0,  -10,   7,  10,  117,   48 }, // U+0068
+    {   9.00f,   2,  -10,   4,  10,  126,   48 }, // U+0069
+    {   9.00f,   1,  -10,   6,  13,  132,   48 }, // U+006A
+    {   9.00f,   0,  -10,   7,  10,  140,   48 }, // U+006B
+    {   9.00f,   2,  -10,   4,  10,  149,   48 }, // U+006C
+    {   9.00f,   0,   -7,   7,   7,  155,   48 }, // U+006D
+    {   9.00f,   0,   -7,   7,   7,  164,   48 }, // U+006E
+    {   9.00f,   0,   -7,   7,   7,  173,   48 }, // U+006F
+    {   9.00f,   0,   -7,   7,  10,  182,   48 }, // U+0070
+    {   9.00f,   0,   -7,   7,  10,  191,   48 }, // U+0071
+    {   9.00f,   0,   -7,   7,   7,  200,   48 }, // U+0072
+    {   9.00f,   0,   -7,   7,   7,  209,   48 }, // U+0073
+    {   9.00f,   0,  -10,   7,  10,  218,   48 }, // U+0074
+    {   9.00f,   0,   -7,   7,   7,  227,   48 }, // U+0075
+    {   9.00f,   0,   -7,   7,   7,  236,   48 }, // U+0076
+    {   9.00f,   0,   -7,   7,   7,  245,   48 }, // U+0077
+    {   9.00f,   0,   -7,   7,   7,    0,   63 }, // U+0078
+    {   9.00f,   0,   -7,   7,  10,    9,   63 }, // U+0079
+    {   9.00f,   0,   -7,   7,   7,   18,   63 }, // U+007A
+    {   9.00f,   1,  -10,   6,  10,   27,   63 }, // U+007B
+    {   9.00f,   3,  -10,   2,  10,   35,   63 }, // U+007C
+    {   9.00f,   1,  -10,   6,  10,   39,   63 }, // U+007D
+    {   9.00f,   0,  -11,   7,   2,   47,   63 }, // U+007E
+    {   9.00f,   0,   -8,   7,   7,   56,   63 }, // U+007F
+    {   9.00f,   0,   -5,   9,   1,   65,   63 }, // U+2500
+    {   9.00f,   0,    0,   0,   0,   76,   63 }, // U+2501
+    {   9.00f,   3,  -12,   2,  16,   78,   63 }, // U+2502
+    {   9.00f,   0,    0,   0,   0,   82,   63 }, // U+2503
+    {   9.00f,   0,    0,   0,   0,   84,   63 }, // U+2504
+    {   9.00f,   0,    0,   0,   0,   86,   63 }, // U+2505
+    {   9.00f,   0,    0,   0,   0,   88,   63 }, // U+2506
+    {   9.00f,   0,    0,   0,   0,   90,   63 }, // U+2507
+    {   9.00f,   0,    0,   0,   0,   92,   63 }, // U+2508
+    {   9.00f,   0,    0,   0,   0,   94,   63 }, // U+2509
+    {   9.00f,   0,    0,   0,   0,   96,   63 }, // U+250A
+    {   9.00f,   0,    0,   0,   0,   98,   63 }, // U+250B
+    {   9.00f,   3,   -5,   6,   9,  100,   63 }, // U+250C
+    {   9.00f,   0,    0,   0,   0,  108,   63 }, // U+250D
+    {   9.00f,   0,    0,   0,   0,  110,   63 }, // U+250E
+    {   9.00f,   0,    0,   0,   0,  112,   63 }, // U+250F
+    {   9.00f,   0,   -5,   5,   9,  114,   63 }, // U+2510
+    {   9.00f,   0,    0,   0,   0,  121,   63 }, // U+2511
+    {   9.00f,   0,    0,   0,   0,  123,   63 }, // U+2512
+    {   9.00f,   0,    0,   0,   0,  125,   63 }, // U+2513
+    {   9.00f,   3,  -12,   6,   8,  127,   63 }, // U+2514
+    {   9.00f,   0,    0,   0,   0,  135,   63 }, // U+2515
+    {   9.00f,   0,    0,   0,   0,  137,   63 }, // U+2516
+    {   9.00f,   0,    0,   0,   0,  139,   63 }, // U+2517
+    {   9.00f,   0,  -12,   5,   8,  141,   63 }, // U+2518
+    {   9.00f,   0,    0,   0,   0,  148,   63 }, // U+2519
+    {   9.00f,   0,    0,   0,   0,  150,   63 }, // U+251A
+    {   9.00f,   0,    0,   0,   0,  152,   63 }, // U+251B
+    {   9.00f,   3,  -12,   6,  16,  154,   63 }, // U+251C
+    {   9.00f,   0,    0,   0,   0,  162,   63 }, // U+251D
+    {   9.00f,   0,    0,   0,   0,  164,   63 }, // U+251E
+    {   9.00f,   0,    0,   0,   0,  166,   63 }, // U+251F
+    {   9.00f,   0,    0,   0,   0,  168,   63 }, // U+2520
+    {   9.00f,   0,    0,   0,   0,  170,   63 }, // U+2521
+    {   9.00f,   0,    0,   0,   0,  172,   63 }, // U+2522
+    {   9.00f,   0,    0,   0,   0,  174,   63 }, // U+2523
+    {   9.00f,   0,  -12,   5,  16,  176,   63 }, // U+2524
+    {   9.00f,   0,    0,   0,   0,  183,   63 }, // U+2525
+    {   9.00f,   0,    0,   0,   0,  185,   63 }, // U+2526
+    {   9.00f,   0,    0,   0,   0,  187,   63 }, // U+2527
+    {   9.00f,   0,    0,   0,   0,  189,   63 }, // U+2528
+    {   9.00f,   0,    0,   0,   0,  191,   63 }, // U+2529
+    {   9.00f,   0,    0,   0,   0,  193,   63 }, // U+252A
+    {   9.00f,   0,    0,   0,   0,  195,   63 }, // U+252B
+    {   9.00f,   0,   -5,   9,   9,  197,   63 }, // U+252C
+    {   9.00f,   0,    0,   0,   0,  208,   63 }, // U+252D
+    {   9.00f,   0,    0,   0,   0,  210,   63 }, // U+252E
+    {   9.00f,   0,    0,   0,   0,  212,   63 }, // U+252F
+    {   9.00f,   0,    0,   0,   0,  214,   63 }, // U+2530
+    {   9.00f,   0,    0,   0,   0,  216,   63 }, // U+2531
+    {   9.00f,   0,    0,   0,   0,  218,   63 }, // U+2532
+    {   9.00f,   0,    0,   0,   0,  220,   63 }, // U+2533
+    {   9.00f,   0,  -12,   9,   8,  222,   63 }, // U+2534
+    {   9.00f,   0,    0,   0,   0,  233,   63 }, // U+2535
+    {   9.00f,   0,    0,   0,   0,  235,   63 }, // U+2536
+    {   9.00f,   0,    0,   0,   0,  237,   63 }, // U+2537
+    {   9.00f,   0,    0,   0,   0,  239,   63 }, // U+2538
+    {   9.00f,   0,    0,   0,   0,  241,   63 }, // U+2539
+    {   9.00f,   0,    0,   0,   0,  243,   63 }, // U+253A
+    {   9.00f,   0,    0,   0,   0,  245,   63 }, // U+253B
+    {   9.00f,   0,  -12,   9,  16,    0,   81 }, // U+253C
+    {   9.00f,   0,    0,   0,   0,   11,   81 }, // U+253D
+    {   9.00f,   0,    0,   0,   0,   13,   81 }, // U+253E
+    {   9.00f,   0,    0,   0,   0,   15,   81 }, // U+253F
+    {   9.00f,   0,    0,   0,   0,   17,   81 }, // U+2540
+    {   9.00f,   0,    0,   0,   0,   19,   81 }, // U+2541
+    {   9.00f,   0,    0,   0,   0,   21,   81 }, // U+2542
+    {   9.00f,   0,    0,   0,   0,   23,   81 }, // U+2543
+    {   9.00f,   0,    0,   0,   0,   25,   81 }, // U+2544
+    {   9.00f,   0,    0,   0,   0,   27,   81 }, // U+2545
+    {   9.00f,   0,    0,   0,   0,   29,   81 }, // U+2546
+    {   9.00f,   0,    0,   0,   0,   31,   81 }, // U+2547
+    {   9.00f,   0,    0,   0,   0,   33,   81 }, // U+2548
+    {   9.00f,   0,    0,   0,   0,   35,   81 }, // U+2549
+    {   9.00f,   0,    0,   0,   0,   37,   81 }, // U+254A
+    {   9.00f,   0,    0,   0,   0,   39,   81 }, // U+254B
+    {   9.00f,   0,    0,   0,   0,   41,   81 }, // U+254C
+    {   9.00f,   0,    0,   0,   0,   43,   81 }, // U+254D
+    {   9.00f,   0,    0,   0,   0,   45,   81 }, // U+254E
+    {   9.00f,   0,    0,   0,   0,   47,   81 }, // U+254F
+    {   9.00f,   0,   -7,   9,   3,   49,   81 }, // U+2550
+    {   9.00f,   2,  -12,   5,  16,   60,   81 }, // U+2551
+    {   9.00f,   3,   -7,   6,  11,   67,   81 }, // U+2552
+    {   9.00f,   2,   -5,   7,   9,   75,   81 }, // U+2553
+    {   9.00f,   2,   -7,   7,  11,   84,   81 }, // U+2554
+    {   9.00f,   0,   -7,   5,  11,   93,   81 }, // U+2555
+    {   9.00f,   0,   -5,   7,   9,  100,   81 }, // U+2556
+    {   9.00f,   0,   -7,   7,  11,  109,   81 }, // U+2557
+    {   9.00f,   3,  -12,   6,   8,  118,   81 }, // U+2558
+    {   9.00f,   2,  -12,   7,   8,  126,   81 }, // U+2559
+    {   9.00f,   2,  -12,   7,   8,  135,   81 }, // U+255A
+    {   9.00f,   0,  -12,   5,   8,  144,   81 }, // U+255B
+    {   9.00f,   0,  -12,   7,   8,  151,   81 }, // U+255C
+    {   9.00f,   0,  -12,   7,   8,  160,   81 }, // U+255D
+    {   9.00f,   3,  -12,   6,  16,  169,   81 }, // U+255E
+    {   9.00f,   2,  -12,   7,  16,  177,   81 }, // U+255F
+    {   9.00f,   2,  -12,   7,  16,  186,   81 }, // U+2560
+    {   9.00f,   0,  -12,   5,  16,  195,   81 }, // U+2561
+    {   9.00f,   0,  -12,   7,  16,  202,   81 }, // U+2562
+    {   9.00f,   0,  -12,   7,  16,  211,   81 }, // U+2563
+    {   9.00f,   0,   -7,   9,  11,  220,   81 }, // U+2564
+    {   9.00f,   0,   -5,   9,   9,  231,   81 }, // U+2565
+    {   9.00f,   0,   -7,   9,  11,  242,   81 }, // U+2566
+    {   9.00f,   0,  -10,   9,   6,    0,   99 }, // U+2567
+    {   9.00f,   0,  -12,   9,   8,   11,   99 }, // U+2568
+    {   9.00f,   0,  -12,   9,   8,   22,   99 }, // U+2569
+    {   9.00f,   0,  -12,   9,  16,   33,   99 }, // U+256A
+    {   9.00f,   0,  -12,   9,  16,   44,   99 }, // U+256B
+    {   9.00f,   0,  -12,   9,  16,   55,   99 }, // U+256C
+    {   9.00f,   0,    0,   0,   0,   66,   99 }, // U+256D
+    {   9.00f,   0,    0,   0,   0,   68,   99 }, // U+256E
+    {   9.00f,   0,    0,   0,   0,   70,   99 }, // U+256F
+    {   9.00f,   0,    0,   0,   0,   72,   99 }, // U+2570
+    {   9.00f,   0,    0,   0,   0,   74,   99 }, // U+2571
+    {   9.00f,   0,    0,   0,   0,   76,   99 }, // U+2572
+    {   9.00f,   0,    0,   0,   0,   78,   99 }, // U+2573
+    {   9.00f,   0,    0,   0,   0,   80,   99 }, // U+2574
+    {   9.00f,   0,    0,   0,   0,   82,   99 }, // U+2575
+    {   9.00f,   0,    0,   0,   0,   84,   99 }, // U+2576
+    {   9.00f,   0,    0,   0,   0,   86,   99 }, // U+2577
+    {   9.00f,   0,    0,   0,   0,   88,   99 }, // U+2578
+    {   9.00f,   0,    0,   0,   0,   90,   99 }, // U+2579
+    {   9.00f,   0,    0,   0,   0,   92,   99 }, // U+257A
+    {   9.00f,   0,    0,   0,   0,   94,   99 }, // U+257B
+    {   9.00f,   0,    0,   0,   0,   96,   99 }, // U+257C
+    {   9.00f,   0,    0,   0,   0,   98,   99 }, // U+257D
+    {   9.00f,   0,    0,   0,   0,  100,   99 }, // U+257E
+    {   9.00f,   0,    0,   0,   0,  102,   99 }, // U+257F
+    {   9.00f,   0,  -12,   9,   7,  104,   99 }, // U+2580
+    {   9.00f,   0,    0,   0,   0,  115,   99 }, // U+2581
+    {   9.00f,   0,    0,   0,   0,  117,   99 }, // U+2582
+    {   9.00f,   0,    0,   0,   0,  119,   99 }, // U+2583
+    {   9.00f,   0,   -5,   9,   9,  121,   99 }, // U+2584
+    {   9.00f,   0,    0,   0,   0,  132,   99 }, // U+2585
+    {   9.00f,   0,    0,   0,   0,  134,   99 }, // U+2586
+    {   9.00f,   0,    0,   0,   0,  136,   99 }, // U+2587
+    {   9.00f,   0,  -12,   9,  16,  138,   99 }, // U+2588
+    {   9.00f,   0,    0,   0,   0,  149,   99 }, // U+2589
+    {   9.00f,   0,    0,   0,   0,  151,   99 }, // U+258A
+    {   9.00f,   0,    0,   0,   0,  153,   99 }, // U+258B
+    {   9.00f,   0,  -12,   4,  16,  155,   99 }, // U+258C
+    {   9.00f,   0,    0,   0,   0,  161,   99 }, // U+258D
+    {   9.00f,   0,    0,   0,   0,  163,   99 }, // U+258E
+    {   9.00f,   0,    0,   0,   0,  165,   99 }, // U+258F
+    {   9.00f,   4,  -12,   5,  16,  167,   99 }, // U+2590
+    {   9.00f,   1,  -12,   7,  16,  174,   99 }, // U+2591
+    {   9.00f,   0,  -12,   9,  16,  183,   99 }, // U+2592
+    {   9.00f,   0,  -12,   8,  16,  194,   99 }, // U+2593
+    {   9.00f,   0,    0,   0,   0,  204,   99 }, // U+2594
+    {   9.00f,   0,    0,   0,   0,  206,   99 }, // U+2595
+    {   9.00f,   0,    0,   0,   0,  208,   99 }, // U+2596
+    {   9.00f,   0,    0,   0,   0,  210,   99 }, // U+2597
+    {   9.00f,   0,    0,   0,   0,  212,   99 }, // U+2598
+    {   9.00f,   0,    0,   0,   0,  214,   99 }, // U+2599
+    {   9.00f,   0,    0,   0,   0,  216,   99 }, // U+259A
+    {   9.00f,   0,    0,   0,   0,  218,   99 }, // U+259B
+    {   9.00f,   0,    0,   0,   0,  220,   99 }, // U+259C
+    {   9.00f,   0,    0,   0,   0,  222,   99 }, // U+259D
+    {   9.00f,   0,    0,   0,   0,  224,   99 }, // U+259E
+    {   9.00f,   0,    0,   0,   0,  226,   99 }, // U+259F
+};
+
+static const unsigned char s_zconsole_atlasdata[29440] =
+{
+//    0    1    2    3    4    5    6    7    8    9   10   11   12   13   14   15
+    255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 0
+      0, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1
+      0,   0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 2
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 3
+      0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 4
+      0, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 5
+      0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, 255, // 6
+      0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, // 7
+    255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 8
+      0, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 9
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 10
+    255,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, // 11
+    255, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 12
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 13
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 14
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 15
+    255, 255,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 16
+    255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, // 17
+    255,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 18
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, // 19
+    255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 20
+    255, 255,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 21
+      0,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 22
+    255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 23
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 24
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 25
+    255,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, // 26
+    255,   0,   0, 255, 255,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0, // 27
+      0,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 28
+    255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, // 29
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 30
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 31
+      0,   0,   0,   0,   0,   0, 255,   0, 255,   0,   0, 255,   0, 255,   0,   0, // 32
+    255, 255,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, // 33
+    255,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, // 34
+    255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 35
+    255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 36
+    255,   0,   0,   0,   0, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 37
+      0,   0,   0,   0,   0, 255, 255,   0, 255,   0,   0, 255, 255,   0,   0, 255, // 38
+    255,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, // 39
+    255, 255, 255, 255, 255,   0,   0, 255, 255,   0, 255, 255,   0, 255, 255,   0, // 40
+      0, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 41
+    255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 42
+    255,   0,   0, 255, 255,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255, // 43
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, // 44
+    255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 45
+      0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 46
+    255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 47
+      0,   0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 48
+    255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, // 49
+    255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255,   0, // 50
+      0, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 51
+      0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 52
+    255,   0,   0,   0,   0, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 53
+      0,   0,   0,   0, 255, 255,   0,   0, 255,   0,   0, 255, 255,   0,   0, 255, // 54
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 55
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, // 56
+      0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, // 57
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 58
+    255,   0,   0, 255, 255,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 59
+    255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 60
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 61
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 62
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 63
+      0,   0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 64
+    255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, // 65
+    255,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255,   0, // 66
+      0, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 67
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 68
+    255, 255,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 69
+      0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 70
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 71
+      0,   0,   0, 255, 255,   0,   0, 255, 255, 255,   0,   0, 255, 255, 255,   0, // 72
+      0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, // 73
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 74
+    255,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255, // 75
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 76
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 77
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 78
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 79
+      0,   0,   0,   0,   0,   0, 255,   0, 255, 255, 255, 255,   0, 255,   0,   0, // 80
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, // 81
+      0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255,   0, // 82
+      0, 255, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 83
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 84
+      0, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, // 85
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, // 86
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 87
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, // 88
+      0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, // 89
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 90
+    255,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0, // 91
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 92
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 93
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 94
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 95
+      0,   0,   0,   0,   0,   0, 255,   0,   0, 255, 255,   0,   0, 255,   0,   0, // 96
+    255, 255, 255,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255,   0, // 97
+      0,   0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 98
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 99
+      0,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0, 255, 255, 255,   0,   0, // 100
+      0,   0,   0,   0,   0,   0,   0,   0, 255,   0,   0, 255, 255,   0,   0, 255, // 101
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0, // 102
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 103
+      0,   0, 255, 255, 255,   0,   0, 255, 255,   0, 255, 255,   0, 255, 255,   0, // 104
+      0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, // 105
+    255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 106
+    255,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0, // 107
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 108
+    255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 109
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 110
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 111
+      0,   0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 112
+    255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255,   0,   0, // 113
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 114
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 115
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 116
+      0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 255, 255, 255, 255,   0, 255, // 117
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, // 118
+    255,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, // 119
+      0,   0, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 120
+      0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, // 121
+    255,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, // 122
+      0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255, // 123
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 124
+    255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, // 125
+    255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 126
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 127
+      0,   0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 128
+    255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, // 129
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 130
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, // 131
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 132
+      0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 255, 255, 255, 255,   0, 255, // 133
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0, // 134
+      0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, // 135
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 136
+      0, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 137
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 138
+    255,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 139
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 140
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 141
+    255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 142
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 143
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 144
+      0, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 145
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 146
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 147
+      0,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0, 255, 255, 255,   0,   0, // 148
+      0,   0,   0,   0,   0,   0,   0,   0, 255,   0,   0, 255, 255,   0,   0, 255, // 149
+      0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 150
+      0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 151
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 152
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 153
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 154
+    255,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, // 155
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 156
+    255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 157
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 158
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 159
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 160
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 161
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 162
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 163
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 164
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, // 165
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 166
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 167
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 168
+      0, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 169
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 170
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 171
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 172
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 173
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 174
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 175
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 176
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 177
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 178
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 179
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 180
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 181
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 182
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 183
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 184
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 185
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 186
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 187
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 188
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 189
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 190
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 191
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 192
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 193
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 194
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 195
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 196
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 197
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 198
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 199
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 200
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 201
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 202
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 203
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 204
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 205
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 206
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 207
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 208
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 209
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 210
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 211
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 212
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 213
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 214
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 215
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 216
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 217
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 218
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 219
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 220
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 221
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 222
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 223
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 224
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 225
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 226
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 227
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 228
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 229
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 230
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 231
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 232
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 233
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 234
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 235
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 236
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 237
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 238
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 239
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 240
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 241
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 242
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 243
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 244
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 245
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 246
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 247
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 248
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 249
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 250
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 251
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 252
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 253
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 254
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 255
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 256
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 257
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 258
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 259
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 260
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 261
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 262
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 263
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 264
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 265
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 266
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 267
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 268
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 269
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 270
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 271
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 272
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 273
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 274
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 275
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 276
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 277
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 278
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 279
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 280
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 281
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 282
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 283
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 284
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 285
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 286
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 287
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 255,   0,   0, // 288
+      0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, // 289
+    255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 290
+    255, 255,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 291
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255,   0,   0,   0, // 292
+      0, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, // 293
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, // 294
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 295
+    255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 296
+      0,   0,   0, 255,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0, // 297
+      0, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0, // 298
+      0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 299
+      0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, // 300
+      0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, // 301
+    255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0, 255, // 302
+    255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 303
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 304
+      0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255, // 305
+    255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 255, 255,   0,   0, // 306
+    255, 255,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 307
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 308
+    255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 309
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 310
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 311
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 312
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, // 313
+    255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 314
+    255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255,   0, // 315
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 316
+      0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 317
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, // 318
+    255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 319
+    255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 320
+      0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, // 321
+    255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, 255, 255,   0,   0, // 322
+    255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, // 323
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 324
+    255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 325
+      0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 326
+    255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 327
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 328
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, // 329
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 330
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 331
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 332
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 333
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 334
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 335
+    255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 336
+      0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, // 337
+    255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 255,   0,   0, // 338
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 339
+      0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 340
+      0, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 341
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 342
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 343
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 344
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 345
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 346
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 347
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 348
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 349
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 350
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 351
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0, 255,   0,   0, // 352
+      0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, // 353
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 354
+      0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 355
+      0,   0,   0, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 356
+    255, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 357
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255, // 358
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 359
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 360
+    255,   0,   0,   0,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0, // 361
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 362
+      0,   0, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 363
+      0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, // 364
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, // 365
+    255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0, // 366
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 367
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 368
+      0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, // 369
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 370
+      0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 371
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, // 372
+    255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 373
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 374
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 375
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 376
+      0,   0,   0,   0,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0, // 377
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 378
+      0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 379
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 380
+    255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, // 381
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 382
+    255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 383
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 384
+      0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255,   0, // 385
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 386
+      0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, // 387
+    255, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, // 388
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 389
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 390
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 391
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 392
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 393
+      0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 394
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 395
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 396
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0, // 397
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 398
+    255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 399
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 400
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 401
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 402
+      0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 403
+      0,   0, 255, 255,   0,   0, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, // 404
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 405
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 406
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 407
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 408
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 409
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 410
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 411
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 412
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0, // 413
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 414
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 415
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 416
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 417
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 418
+      0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 419
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 420
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 421
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 422
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 423
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 424
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, // 425
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 426
+    255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 427
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 428
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0, // 429
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 430
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 431
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 432
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 433
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 434
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 435
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 436
+    255, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 437
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 438
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 439
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 440
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, // 441
+    255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 442
+      0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, // 443
+      0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, // 444
+    255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 445
+    255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, // 446
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 447
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 448
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 449
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 450
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 451
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 452
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 453
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 454
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 455
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 456
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 457
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 458
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 459
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 460
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 461
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 462
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 463
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 464
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 465
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 466
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 467
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 468
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 469
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 470
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 471
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 472
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 473
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 474
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 475
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 476
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 477
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 478
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 479
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 480
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 481
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 482
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 483
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 484
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 485
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 486
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 487
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 488
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 489
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 490
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 491
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 492
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 493
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 494
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 495
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 496
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 497
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 498
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 499
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 500
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 501
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 502
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 503
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 504
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 505
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 506
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 507
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 508
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 509
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 510
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 511
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 512
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 513
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 514
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 515
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 516
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 517
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 518
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 519
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 520
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 521
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 522
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 523
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 524
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 525
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 526
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 527
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 528
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 529
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 530
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 531
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 532
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 533
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 534
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 535
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 536
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 537
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 538
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 539
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 540
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 541
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 542
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 543
+    255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 544
+      0, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, // 545
+      0,   0,   0,   0,   0, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, // 546
+    255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, // 547
+    255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, // 548
+    255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, // 549
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0, // 550
+      0,   0,   0, 255, 255, 255, 255,   0,   0, 255, 255, 255,   0,   0, 255, 255, // 551
+      0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 552
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 553
+    255, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 554
+    255, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0, // 555
+      0,   0, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 556
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 557
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 558
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, // 559
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 560
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 561
+      0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 562
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 563
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 564
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 565
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 566
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, // 567
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255,   0, 255, // 568
+    255, 255,   0,   0, 255, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 569
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 570
+    255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 571
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, // 572
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 573
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 574
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, // 575
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 576
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 577
+      0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 578
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255,   0,   0,   0, 255, 255, // 579
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255,   0,   0,   0, // 580
+    255, 255,   0,   0,   0, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255,   0, // 581
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 582
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, // 583
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, // 584
+    255, 255,   0,   0, 255, 255, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0, // 585
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 586
+    255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 587
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255,   0, 255, 255,   0, 255, // 588
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 589
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 590
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, // 591
+    255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 592
+      0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255, 255, 255, 255, // 593
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 594
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 595
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255,   0,   0,   0,   0,   0, // 596
+    255, 255,   0, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 597
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 598
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 599
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, // 600
+    255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0, // 601
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 602
+    255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 603
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 604
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 605
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 606
+    255, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, // 607
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 608
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255, 255, 255, // 609
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, // 610
+    255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 611
+      0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, // 612
+    255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 613
+      0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 614
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, // 615
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255,   0, // 616
+    255, 255,   0,   0, 255, 255,   0, 255, 255, 255, 255,   0,   0, 255, 255,   0, // 617
+      0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0, 255, // 618
+    255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, // 619
+      0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 620
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 621
+    255, 255,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 622
+    255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, // 623
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 624
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255, 255, 255, // 625
+      0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 626
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 627
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255,   0,   0,   0,   0,   0, // 628
+    255, 255,   0, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255, 255, 255,   0, // 629
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 630
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0, // 631
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 632
+    255, 255,   0,   0, 255, 255,   0,   0, 255, 255, 255,   0,   0, 255, 255,   0, // 633
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, // 634
+    255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 635
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 636
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 637
+    255, 255,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 638
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 639
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 640
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255, 255,   0, // 641
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 642
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 643
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 644
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 645
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 646
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 647
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 648
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 649
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, // 650
+    255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 651
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 652
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 653
+    255, 255,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0, 255, 255, // 654
+    255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 655
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 656
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 657
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 658
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255,   0,   0,   0, 255, 255, // 659
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255,   0,   0,   0, // 660
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 661
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 662
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, // 663
+      0,   0,   0, 255, 255,   0,   0,   0, 255,   0,   0, 255, 255,   0,   0,   0, // 664
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 665
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, // 666
+    255,   0, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 667
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 668
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255, // 669
+    255,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0, 255, 255, // 670
+      0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 671
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 672
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, // 673
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 674
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 675
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 676
+    255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 677
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 678
+    255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, // 679
+      0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 680
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 681
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, // 682
+    255,   0, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 683
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 684
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, // 685
+      0,   0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0, 255, 255,   0, // 686
+      0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 687
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 688
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 689
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, // 690
+    255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, // 691
+    255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, // 692
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255,   0, 255,   0, // 693
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0, // 694
+      0, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255,   0,   0, 255, 255, // 695
+      0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 696
+    255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 697
+    255, 255, 255,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 698
+    255, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255,   0,   0, 255, 255,   0, // 699
+      0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 700
+      0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255,   0, // 701
+      0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 702
+      0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, // 703
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 704
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 705
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 706
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 707
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 708
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 709
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 710
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 711
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 712
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 713
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 714
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 715
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 716
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 717
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 718
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 719
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 720
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 721
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 722
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 723
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 724
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 725
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 726
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 727
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 728
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 729
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 730
+      0,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 731
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 732
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 733
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 734
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 735
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 736
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 737
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 738
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 739
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 740
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 741
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 742
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 743
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 744
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 745
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 746
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 747
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 748
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 749
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 750
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 751
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 752
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 753
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 754
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 755
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 756
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 757
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 758
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 759
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 760
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 761
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 762
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 763
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 764
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 765
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 766
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 767
+    255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0, 255, // 768
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, // 769
+      0, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255,   0, // 770
+      0, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, // 771
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0, // 772
+      0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, // 773
+    255,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, // 774
+      0, 255, 255,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, // 775
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255,   0, // 776
+      0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0, 255, 255, 255,   0, 255, // 777
+    255,   0,   0,   0, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255, // 778
+    255, 255, 255,   0,   0,   0, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0, // 779
+    255, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0, 255, 255, 255,   0,   0, // 780
+      0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255,   0,   0, // 781
+      0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 782
+      0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 783
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, // 784
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 785
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 786
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, // 787
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 788
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 789
+    255, 255,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0,   0, // 790
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, // 791
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 792
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, // 793
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 794
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 795
+    255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255,   0, 255, 255,   0, // 796
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 797
+      0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 798
+      0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 799
+    255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, // 800
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, // 801
+    255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 802
+      0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0, // 803
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 804
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, // 805
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255,   0,   0, 255, 255,   0,   0, // 806
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, // 807
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 808
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255,   0, // 809
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 810
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 811
+    255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 812
+      0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 813
+      0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 814
+      0, 255, 255,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0,   0, // 815
+      0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 816
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, // 817
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 818
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 819
+      0, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 820
+      0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 821
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 822
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255, // 823
+    255,   0,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0, 255, 255,   0, // 824
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255,   0, // 825
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 826
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 827
+    255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 828
+      0,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 829
+      0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 830
+      0, 255, 255,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0,   0, // 831
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 832
+      0, 255, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 833
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 834
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 835
+      0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 836
+      0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 837
+      0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 838
+    255, 255,   0,   0,   0,   0, 255, 255, 255,   0, 255, 255,   0,   0,   0, 255, // 839
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 840
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255,   0, // 841
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 842
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 843
+    255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 844
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 845
+      0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, // 846
+      0, 255, 255,   0,   0, 255, 255,   0, 255,   0, 255, 255,   0,   0,   0,   0, // 847
+      0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 848
+      0,   0, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 849
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 850
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, // 851
+      0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 852
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 853
+    255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 854
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, // 855
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, // 856
+    255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, 255,   0, // 857
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255,   0, // 858
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0, 255, // 859
+    255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 860
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0, // 861
+      0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, // 862
+    255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 863
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 864
+      0,   0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 865
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 866
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255,   0, 255, 255,   0,   0, // 867
+      0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255,   0, // 868
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, // 869
+    255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255, // 870
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, // 871
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, // 872
+    255,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, // 873
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 874
+    255, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 875
+    255, 255, 255, 255, 255,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, // 876
+      0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 877
+      0,   0,   0,   0, 255, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255, // 878
+    255,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, // 879
+    255, 255,   0,   0,   0,   0, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 880
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 881
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 882
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 883
+      0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 884
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, // 885
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 886
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, // 887
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 888
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, // 889
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 890
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 891
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 892
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 893
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 894
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 895
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 896
+      0,   0,   0,   0,   0, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 897
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 898
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 899
+      0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 900
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, // 901
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0,   0, // 902
+    255, 255,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, // 903
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 904
+      0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, // 905
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 906
+      0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 907
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 908
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 909
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 910
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 911
+    255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0,   0, // 912
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0, // 913
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 914
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 915
+      0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 916
+      0,   0,   0, 255, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 917
+      0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255, // 918
+    255,   0,   0,   0,   0, 255, 255, 255,   0,   0, 255, 255,   0,   0, 255, 255, // 919
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255, 255,   0, // 920
+      0, 255, 255,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 921
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 922
+      0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 923
+      0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 924
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, // 925
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 926
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 927
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 928
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 929
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 930
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 931
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 932
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 933
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 934
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 935
+      0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 936
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 937
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 938
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 939
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 940
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 941
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 942
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 943
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 944
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 945
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 946
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 947
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 948
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 949
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 950
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 951
+      0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 952
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 953
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 954
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 955
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 956
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 957
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 958
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 959
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 960
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 961
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 962
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 963
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 964
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 965
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 966
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 967
+      0,   0,   0,   0,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 968
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 969
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 970
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 971
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 972
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 973
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 974
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 975
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 976
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 977
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 978
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 979
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 980
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 981
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 982
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 983
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 984
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 985
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 986
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 987
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 988
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 989
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 990
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 991
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 992
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 993
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 994
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 995
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 996
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 997
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 998
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 999
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1000
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1001
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1002
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1003
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1004
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1005
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1006
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1007
+    255, 255,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 1008
+      0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, // 1009
+    255,   0,   0, 255, 255,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1010
+    255, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255,   0,   0,   0,   0, // 1011
+      0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, // 1012
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1013
+      0,   0,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1014
+      0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1015
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1016
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1017
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1018
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1019
+      0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 1020
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1021
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1022
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1023
+      0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 1024
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255,   0, // 1025
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, // 1026
+    255,   0, 255, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0, // 1027
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1028
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1029
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1030
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1031
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1032
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1033
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1034
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1035
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1036
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1037
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1038
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1039
+      0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 1040
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1041
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1042
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1043
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1044
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1045
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1046
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1047
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1048
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1049
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1050
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1051
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1052
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1053
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1054
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1055
+      0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 1056
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1057
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1058
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 1059
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1060
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1061
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1062
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1063
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1064
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1065
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1066
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1067
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1068
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1069
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1070
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1071
+      0,   0, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 1072
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0, // 1073
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, 255, 255,   0,   0,   0, // 1074
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 1075
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1076
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1077
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1078
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1079
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1080
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1081
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1082
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1083
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1084
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1085
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1086
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1087
+      0, 255, 255,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, // 1088
+      0,   0, 255, 255,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, // 1089
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1090
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255,   0, // 1091
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1092
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1093
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1094
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1095
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1096
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1097
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1098
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1099
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1100
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1101
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1102
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1103
+    255, 255,   0,   0,   0, 255, 255,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1104
+      0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0, // 1105
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1106
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0, // 1107
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1108
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1109
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1110
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1111
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1112
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1113
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1114
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1115
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1116
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1117
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1118
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1119
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1120
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1121
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1122
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1123
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1124
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1125
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1126
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1127
+    255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, // 1128
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1129
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1130
+    255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1131
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1132
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1133
+    255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1134
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1135
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1136
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1137
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1138
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1139
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1140
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1141
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1142
+      0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1143
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1144
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1145
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1146
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1147
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1148
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1149
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1150
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1151
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, // 1152
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1153
+    255,   0,   0, 255, 255,   0,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1154
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1155
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1156
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1157
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1158
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1159
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1160
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1161
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1162
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1163
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1164
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1165
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1166
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1167
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1168
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1169
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1170
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1171
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1172
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1173
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1174
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1175
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1176
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1177
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1178
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1179
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1180
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1181
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1182
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1183
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1184
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1185
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1186
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1187
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1188
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1189
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1190
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1191
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1192
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1193
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1194
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1195
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1196
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1197
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1198
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1199
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1200
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1201
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1202
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1203
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1204
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1205
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1206
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1207
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1208
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1209
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1210
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1211
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1212
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1213
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1214
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1215
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1216
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1217
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1218
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1219
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1220
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1221
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1222
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1223
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1224
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1225
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1226
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1227
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1228
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1229
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1230
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1231
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1232
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1233
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1234
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1235
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1236
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1237
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1238
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1239
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1240
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1241
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1242
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1243
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1244
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1245
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1246
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1247
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1248
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1249
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1250
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1251
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1252
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1253
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1254
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1255
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1256
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1257
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1258
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1259
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1260
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1261
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1262
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1263
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1264
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1265
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1266
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1267
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1268
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1269
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1270
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1271
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1272
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1273
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1274
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1275
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1276
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1277
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1278
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1279
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1280
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1281
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1282
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1283
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1284
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1285
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1286
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1287
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1288
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1289
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1290
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1291
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1292
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1293
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1294
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1295
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1296
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1297
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1298
+      0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0, 255, // 1299
+    255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, // 1300
+    255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, // 1301
+    255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, // 1302
+    255, 255, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 1303
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, // 1304
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1305
+      0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1306
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1307
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1308
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255, 255, 255, // 1309
+    255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255, // 1310
+      0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0, // 1311
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1312
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1313
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1314
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1315
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1316
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1317
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, // 1318
+      0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 1319
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, // 1320
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1321
+      0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1322
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1323
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1324
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1325
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1326
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1327
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1328
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1329
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1330
+      0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0, 255, // 1331
+    255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255,   0, 255, 255, // 1332
+      0,   0,   0,   0, 255, 255,   0, 255, 255, 255, 255,   0,   0, 255, 255, 255, // 1333
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255, 255, // 1334
+    255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 1335
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, // 1336
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1337
+      0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1338
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1339
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1340
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255, 255, 255, // 1341
+    255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1342
+      0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0,   0,   0,   0,   0, // 1343
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1344
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1345
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1346
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1347
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1348
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1349
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 1350
+    255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 1351
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, // 1352
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1353
+      0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1354
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1355
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1356
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1357
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1358
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1359
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1360
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1361
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1362
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1363
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1364
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1365
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 1366
+    255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 1367
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, // 1368
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1369
+      0,   0, 255, 255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1370
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1371
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1372
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1373
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1374
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1375
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1376
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1377
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1378
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1379
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1380
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1381
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 1382
+    255,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, // 1383
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255, 255, 255,   0,   0, // 1384
+    255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1385
+    255, 255, 255, 255,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255,   0, // 1386
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255, 255, // 1387
+    255,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1388
+    255,   0,   0, 255, 255, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1389
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1390
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1391
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1392
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1393
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1394
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1395
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1396
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1397
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 1398
+    255,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255, // 1399
+      0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1400
+      0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1401
+      0,   0,   0,   0,   0, 255, 255,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1402
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, // 1403
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1404
+    255,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1405
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1406
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1407
+    255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1408
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1409
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1410
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1411
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1412
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1413
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 1414
+    255,   0, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, // 1415
+    255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 1416
+    255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255,   0,   0, // 1417
+    255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255,   0, // 1418
+      0, 255, 255,   0, 255, 255, 255, 255,   0,   0, 255, 255,   0, 255, 255, 255, // 1419
+    255,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255,   0, 255, // 1420
+    255,   0,   0, 255, 255, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1421
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1422
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1423
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1424
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1425
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1426
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1427
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255, // 1428
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1429
+    255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, // 1430
+    255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1431
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1432
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1433
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1434
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1435
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1436
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1437
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1438
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1439
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1440
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1441
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1442
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1443
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1444
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1445
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1446
+    255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1447
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1448
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1449
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1450
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1451
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1452
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1453
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1454
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1455
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1456
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1457
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1458
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1459
+    255,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1460
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1461
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, // 1462
+    255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1463
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1464
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1465
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1466
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1467
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1468
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0, 255, // 1469
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1470
+      0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0, // 1471
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1472
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1473
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1474
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1475
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1476
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1477
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1478
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1479
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1480
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1481
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1482
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1483
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1484
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1485
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1486
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1487
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1488
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1489
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1490
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1491
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1492
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1493
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1494
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1495
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1496
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1497
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1498
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1499
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1500
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1501
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1502
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1503
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1504
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1505
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1506
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1507
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1508
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1509
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1510
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1511
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1512
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1513
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1514
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1515
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1516
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1517
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1518
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1519
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1520
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1521
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1522
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1523
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1524
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1525
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1526
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1527
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1528
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1529
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1530
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1531
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1532
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1533
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1534
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1535
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1536
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1537
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1538
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, // 1539
+    255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1540
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1541
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1542
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1543
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1544
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1545
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0, // 1546
+      0, 255, 255,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0, // 1547
+      0,   0,   0,   0,   0,   0, 255, 255,   0,   0,   0,   0, 255, 255,   0, 255, // 1548
+    255,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0,   0,   0,   0, // 1549
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1550
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1551
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1552
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1553
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1554
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1555
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1556
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1557
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1558
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1559
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1560
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1561
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1562
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1563
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1564
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1565
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1566
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1567
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1568
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1569
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1570
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1571
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1572
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1573
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1574
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1575
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1576
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1577
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1578
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1579
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1580
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1581
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1582
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1583
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1584
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, // 1585
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1586
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1587
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1588
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1589
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 1590
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1591
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1592
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1593
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1594
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   4, 255,   8, 255,   4, 255,   0, // 1595
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1596
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1597
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1598
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1599
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1600
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, // 1601
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1602
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1603
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1604
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1605
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 1606
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1607
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1608
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1609
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1610
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 255,   0, 255,   0, 255,   0,   0, // 1611
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1612
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1613
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1614
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1615
+      0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1616
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, // 1617
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1618
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1619
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1620
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1621
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 1622
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1623
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1624
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1625
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1626
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   0, 255,   5, 255,   5, 252,   1, // 1627
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1628
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1629
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1630
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1631
+    255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0, // 1632
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, // 1633
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1634
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1635
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1636
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1637
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 1638
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1639
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1640
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1641
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1642
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 252,   4, 252,   4, 252,   4,   0, // 1643
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1644
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1645
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1646
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1647
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1648
+    255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0,   0, // 1649
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1650
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1651
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1652
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1653
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 1654
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1655
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1656
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1657
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1658
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   0, 255,   5, 255,   5, 252,   1, // 1659
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1660
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1661
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1662
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1663
+    255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255,   0, // 1664
+    255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255,   0, // 1665
+      0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0,   0,   0, 255, 255, // 1666
+      0, 255, 255,   0,   0,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255, // 1667
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1668
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1669
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 1670
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1671
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1672
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1673
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1674
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 252,   4, 252,   4, 252,   4,   0, // 1675
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1676
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1677
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1678
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1679
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255,   0, // 1680
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1681
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1682
+      0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1683
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1684
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1685
+      0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, // 1686
+    255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1687
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1688
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1689
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1690
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   0, 255,   5, 255,   5, 252,   1, // 1691
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1692
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1693
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1694
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1695
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, // 1696
+    255, 255, 255, 255,   0,   0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0, // 1697
+      0, 255, 255, 255, 255, 255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255, // 1698
+    255, 255, 255, 255, 255,   0,   0, 255, 255, 255, 255,   0, 255, 255, 255, 255, // 1699
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1700
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1701
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1702
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1703
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1704
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1705
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1706
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 252,   4, 252,   4, 252,   4,   0, // 1707
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1708
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1709
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1710
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1711
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1712
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1713
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1714
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1715
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1716
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1717
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1718
+      0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, 255, // 1719
+    255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1720
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1721
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1722
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   0, 255,   5, 255,   5, 252,   1, // 1723
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1724
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1725
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1726
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1727
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1728
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1729
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1730
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1731
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1732
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1733
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1734
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1735
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1736
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1737
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1738
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 252,   4, 252,   4, 252,   4,   0, // 1739
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1740
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1741
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1742
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1743
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1744
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1745
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1746
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1747
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1748
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1749
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1750
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1751
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1752
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1753
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1754
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   0, 255,   5, 255,   5, 252,   1, // 1755
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1756
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1757
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1758
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1759
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1760
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1761
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1762
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1763
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1764
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1765
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1766
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1767
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1768
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1769
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1770
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 252,   4, 252,   4, 252,   4,   0, // 1771
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1772
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1773
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1774
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1775
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1776
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1777
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1778
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1779
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1780
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1781
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1782
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1783
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1784
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1785
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1786
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   0, 255,   5, 255,   5, 252,   2, // 1787
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1788
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1789
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1790
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1791
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1792
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1793
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1794
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1795
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1796
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1797
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1798
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1799
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1800
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1801
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1802
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 252,   3, 252,   3, 252,   3,   0, // 1803
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1804
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1805
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1806
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1807
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1808
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1809
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1810
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1811
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1812
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1813
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1814
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1815
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1816
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1817
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0,   0,   0, // 1818
+    255,   0,   0,   0, 255,   0,   0,   0, 255,   0, 255,   5, 255,   5, 252,   2, // 1819
+      0,   0, 255, 255,   0, 255, 255, 255,   0, 255,   0,   0,   0,   0,   0,   0, // 1820
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1821
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1822
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1823
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1824
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1825
+      0,   0,   0,   0, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, // 1826
+      0, 255, 255,   0,   0,   0,   0,   0,   0, 255, 255,   0, 255, 255,   0,   0, // 1827
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1828
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1829
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1830
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1831
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255, 255, // 1832
+    255, 255, 255,   0,   0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255,   0, // 1833
+      0,   0,   0,   0,   0,   0,   0, 255, 255, 255, 255, 255,   0,   0, 255,   0, // 1834
+      0,   0, 255,   0,   0,   0,   0, 255,   0, 252,   3, 252,   3, 252,   3,   0, // 1835
+      0,   0,   0, 255, 255, 255,   0, 255, 255, 255,   0,   0,   0,   0,   0,   0, // 1836
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1837
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1838
+      0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0, // 1839
+};
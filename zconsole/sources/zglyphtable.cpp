@@ -0,0 +1,157 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zglyphtable.cpp
+* Desc: precomputed glyph metrics for the console font
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/  
+#include "zfontatlas.hpp"
+#include "zglyphtable.hpp"
+
+
+
+bool Zconsole::ZglyphTable::rebuild(
+	const sf::Font& _font, 
+	unsigned int    _charsize) {
+
+	unsigned int index, codepoint;
+
+	m_font        = &_font;
+	m_charsize    = _charsize;
+	m_linespacing = _font.getLineSpacing(_charsize);
+
+	m_glyphs.resize(
+		ZCONSOLE_GLYPHASCII + 
+		(ZCONSOLE_GLYPHBOXMAX - ZCONSOLE_GLYPHBOXMIN));
+	/*
+	Copy the glyph descriptions, this also forces every glyph
+	the console uses to be rasterized up front:*/
+	for (index = 0; index < m_glyphs.size(); ++index) {
+		codepoint = index;
+		if (index >= ZCONSOLE_GLYPHASCII) 
+			codepoint += ZCONSOLE_GLYPHBOXMIN - ZCONSOLE_GLYPHASCII;
+		m_glyphs[index] = _font.getGlyph(codepoint, _charsize, false);
+	}
+	updateMonospace();
+
+	/*
+	When the font page cannot grow past the maximum texture size, 
+	SFML places the glyph in a 2x2 rect and removes the padding from
+	it, so a glyph with a shape is left with an empty texture rect:*/
+	if (_font.getTexture(_charsize).getSize().x == 0)
+		return false;
+	for (const auto& glyph : m_glyphs) {
+		if (glyph.bounds.width > 0 && glyph.bounds.height > 0 &&
+			(glyph.textureRect.width <= 0 || glyph.textureRect.height <= 0))
+			return false;
+	}
+	return true;
+} 
+
+
+bool Zconsole::ZglyphTable::rebuild() {
+	static_assert(
+		ZFONTATLAS_GLYPHCOUNT == 
+		ZCONSOLE_GLYPHASCII + (ZCONSOLE_GLYPHBOXMAX - ZCONSOLE_GLYPHBOXMIN),
+		"zfontatlas.hpp is out of date, run tools/zfontbake again");
+
+	unsigned int index;
+
+	m_font        = nullptr;
+	m_charsize    = ZFONTATLAS_CHARSIZE;
+	m_linespacing = ZFONTATLAS_LINESPACING;
+
+	m_glyphs.resize(ZFONTATLAS_GLYPHCOUNT);
+	for (index = 0; index < m_glyphs.size(); ++index) {
+		const zfontatlasglyph& baked = s_zconsole_atlasglyphs[index];
+
+		m_glyphs[index].advance     = baked.advance;
+		m_glyphs[index].bounds      = sf::FloatRect(
+			(float)baked.left,  (float)baked.top, 
+			(float)baked.width, (float)baked.height);
+		m_glyphs[index].textureRect = sf::IntRect(
+			baked.u, baked.v, baked.width, baked.height);
+	}
+	/*
+	Expand the alpha atlas to white pixels, the same format as 
+	sf::Font pages, and upload it in one go:*/
+	std::vector<sf::Uint8> pixels(ZFONTATLAS_WIDTH * ZFONTATLAS_HEIGHT * 4);
+	for (index = 0; index < ZFONTATLAS_WIDTH * ZFONTATLAS_HEIGHT; ++index) {
+		pixels[index * 4 + 0] = 0xFF;
+		pixels[index * 4 + 1] = 0xFF;
+		pixels[index * 4 + 2] = 0xFF;
+		pixels[index * 4 + 3] = s_zconsole_atlasdata[index];
+	}
+	updateMonospace();
+	if (!m_atlas.create(ZFONTATLAS_WIDTH, ZFONTATLAS_HEIGHT))
+		return false;
+	m_atlas.update(pixels.data());
+	m_atlas.setSmooth(true);
+	return true;
+}
+
+
+const sf::Texture& Zconsole::ZglyphTable::getTexture() const {
+	if (m_font)
+		return m_font->getTexture(m_charsize);
+	return m_atlas;
+}
+
+
+void Zconsole::ZglyphTable::updateMonospace() {
+	unsigned int index;
+	float        advance;
+
+	m_monospace = true;
+	/*
+	The font is treated as monospace if all printable ascii 
+	glyphs advance by the same amount as a space:*/
+	advance = m_glyphs[' '].advance;
+	for (index = ' ' + 1; index < ZCONSOLE_GLYPHASCII - 1; ++index) {
+		if (m_glyphs[index].advance != advance) {
+			m_monospace = false;
+			break;
+		}
+	}
+}
+
+
+bool Zconsole::ZglyphTable::isMonospace() const {
+	return m_monospace;
+}
+
+
+unsigned int Zconsole::ZglyphTable::getCharacterSize() const {
+	return m_charsize;
+}
+
+
+float Zconsole::ZglyphTable::getLineSpacing() const {
+	return m_linespacing;
+}
+
+
+unsigned int Zconsole::ZglyphTable::size() const {
+	return m_glyphs.size();
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
@@ -0,0 +1,136 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zglyphtable.hpp
+* Desc: precomputed glyph metrics for the console font
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZGLYPHTABLE_HPP__
+#define __ZGLYPHTABLE_HPP__
+
+#include "zconsoledefs.hpp"
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::ZglyphTable final  {
+public: 
+	ZglyphTable(Zconsole* const _lpconsole) :
+		m_font(nullptr),
+		m_lpconsole(_lpconsole) {}
+	~ZglyphTable() {}	
+
+	/*
+	Rasterize and cache the glyph set used by the console.
+	Must be called again whenever the font or character size changes.
+	@_font    : the font to cache glyphs from
+	@_charsize: the character size glyphs are rasterized at
+	@return   : false if the glyphs did not fit in a font texture*/
+	bool rebuild(const sf::Font& _font, unsigned int _charsize);
+
+	/*
+	Load the glyph table from the atlas baked into the library 
+	(zfontatlas.hpp), no font is needed and nothing is rasterized.
+	@return: false if the atlas texture could not be created*/
+	bool rebuild();
+
+	/*
+	Returns the texture holding the cached glyphs*/
+	const sf::Texture& getTexture() const;
+
+	/*
+	Returns true if every cached glyph shares the same advance,
+	in which case kerning is skipped entirely*/
+	bool isMonospace() const;
+
+	/*
+	Returns the character size the table was built for*/
+	unsigned int getCharacterSize() const;
+
+	/*
+	Returns the line spacing of the cached font*/
+	float getLineSpacing() const;
+
+	/*
+	Returns the description of a glyph. Codepoints within the
+	ascii and box-drawing ranges are a plain array lookup,
+	anything else falls back to the font.
+	@_codepoint: unicode value of the glyph*/
+	inline const sf::Glyph& getGlyph(unsigned int _codepoint) const {
+		const int index = getIndex(_codepoint);
+		if (index >= 0)
+			return m_glyphs[index];
+		if (!m_font)
+			return m_glyphs['?'];
+		return m_font->getGlyph(_codepoint, m_charsize, false);
+	}
+
+	/*
+	Returns the slot of a glyph within the table, 
+	or -1 if the codepoint is not cached.
+	@_codepoint: unicode value of the glyph*/
+	inline int getIndex(unsigned int _codepoint) const {
+		if (_codepoint < ZCONSOLE_GLYPHASCII)
+			return (int)_codepoint;
+		if (_codepoint - ZCONSOLE_GLYPHBOXMIN < 
+			ZCONSOLE_GLYPHBOXMAX - ZCONSOLE_GLYPHBOXMIN)
+			return (int)(
+				ZCONSOLE_GLYPHASCII + 
+				(_codepoint - ZCONSOLE_GLYPHBOXMIN));
+		return -1;
+	}
+
+	/*
+	Returns the description of the glyph stored in a slot.
+	@_index: slot of the glyph, must be less than size()*/
+	inline const sf::Glyph& getGlyphAt(unsigned int _index) const {
+		return m_glyphs[_index];
+	}
+
+	/*
+	Returns the number of slots in the table*/
+	unsigned int size() const;
+
+	/*
+	Returns the kerning offset between two glyphs,
+	always zero for monospace fonts and the baked atlas.
+	@_first : unicode value of the previous glyph
+	@_second: unicode value of the current glyph*/
+	inline float getKerning(unsigned int _first, unsigned int _second) const {
+		if (m_monospace || !m_font)
+			return 0.f;
+		return m_font->getKerning(_first, _second, m_charsize);
+	}
+
+private:
+	void updateMonospace();
+
+	std::vector<sf::Glyph> m_glyphs;      //flat table indexed by codepoint
+	sf::Texture            m_atlas;       //baked glyphs, when not from a font
+	const sf::Font*        m_font;        //font the table was built from
+	unsigned int           m_charsize;    //character size of the glyphs
+	float                  m_linespacing; //cached line spacing 
+	bool                   m_monospace;   //all glyphs share one advance
+	Zconsole* const        m_lpconsole;
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -1,217 +1,803 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: zhelperfuncs.cpp
-* Desc: helper functions
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/ 
-#include <sstream>
-#include <iomanip>
-#include "zhelperfuncs.hpp"
-
-
-
-void 
-Zconsole_GetColorCodes(
-	unsigned int  _index,
-	unsigned int& _rgba,
-	zstring&      _cstr) {
-
-	switch (_index) {
-	case 0x0: _rgba = 0x087C00FF; _cstr = "Green";     break;
-	case 0x1: _rgba = 0x783C00FF; _cstr = "Brown";     break;
-	case 0x2: _rgba = 0xFFB000FF; _cstr = "Amber";     break;
-	case 0x3: _rgba = 0x808080FF; _cstr = "Grey";      break;
-	case 0x4: _rgba = 0x982220FF; _cstr = "Red";       break;
-	case 0x5: _rgba = 0x800080FF; _cstr = "Purple";    break;
-	case 0x6: _rgba = 0x00FFFFFF; _cstr = "Cyan";      break;
-	case 0x7: _rgba = 0xE454ECFF; _cstr = "Magenta";   break;
-	case 0x8: _rgba = 0x00FF00FF; _cstr = "Lt Green";  break;
-	case 0x9: _rgba = 0x2245FFFF; _cstr = "Blue";      break;
-	case 0xA: _rgba = 0xC0C0C0FF; _cstr = "White";     break;
-	}
-}
-
-
-int
-Zconsole_ArgToBool(
-	const zstring& _arg0) {
-
-	if (_arg0 == "enable" || 
-		_arg0 == "on"     ||
-		_arg0 == "true"   || 
-		_arg0 == "1") 
-		return 1;
-	if (_arg0 == "disable" ||
-		_arg0 == "off"     ||
-		_arg0 == "false"   || 
-		_arg0 == "0") 
-		 return 0; 
-	return -1;
-} 
-
-
-zstring 
-Zconsole_StringToLower(
-	const zstring& _strIn) { 
-
-	zstring strOut(_strIn);
-	std::transform(
-		strOut.begin(), strOut.end(), strOut.begin(), tolower);
-	return strOut;
-}
-
-
-float
-Zconsole_StringToFloat(
-	const zstring& _in) { 
-
-	float              out;
-	std::istringstream str;
-	str = std::istringstream(_in);
-	if (str >> out)
-		return out;
-	return 0.f;
-}
-
-
-zstring 
-Zconsole_UintToHexString(
-	unsigned int   _hexvalue,
-	const zstring& _hexformat) {
-
-	zstring            prefix;
-	std::streamsize    width;
-	std::ostringstream conversion;
-
-	prefix = "0x";
-	/*
-	determine format:*/
-	if (_hexformat.find('n', 5) != std::string::npos)
-		prefix = "";
-	if (_hexformat.find('1', 4) != std::string::npos)
-		width = 1;
-	else if (_hexformat.find('2', 4) != std::string::npos)
-		width = 2;
-	else if (_hexformat.find('8', 4) != std::string::npos)
-		width = 8;
-	/*
-	build the string:*/
-	conversion
-		<< std::uppercase
-		<< std::right
-		<< std::setfill('0')
-		<< std::setw(width)
-		<< std::hex
-		<< _hexvalue;
-	return conversion.str();
-}
-
-
-unsigned int
-Zconsole_HexStringToUint(zstring _hexstring) {  
-	unsigned int       value;
-	std::istringstream converter;
-
-	_hexstring = Zconsole_StringToLower(_hexstring);
-	if (_hexstring.length() > 1) {
-		if (_hexstring[0] == '0' && _hexstring[1] == 'x') {
-			_hexstring.erase(_hexstring.begin());
-			_hexstring.erase(_hexstring.begin());
-		}
-	}
-	converter = std::istringstream(_hexstring);
-	converter >> std::hex >> value;
-	return value;
-}
-
-
-sf::Color 
-Zconsole_GetColorFromUint(
-	unsigned int _color) {
-
-	sf::Color color;
-	color.r = (_color & 0xFF000000) >> 0x18;
-	color.g = (_color & 0x00FF0000) >> 0x10;
-	color.b = (_color & 0x0000FF00) >> 0x08;
-	color.a = (_color & 0x000000FF);
-	return color;
-}
-
-
-zstrings 
-Zconsole_TokenizeString(
-	const zstring& _string, 
-	char           _token) {
-
-	zstrings          output;
-	std::stringstream stream;
-	std::string       tokenizedstr;
-
-	if (!_string.empty()) {
-		stream = std::stringstream(_string);
-
-		while (std::getline(stream, tokenizedstr, _token)) {
-			if (!tokenizedstr.empty())
-				output.push_back(tokenizedstr);
-		}
-	}
-	return output;
-}
-
-
-sf::FloatRect
-Zconsole_GetVerticesBounds(
-	const zvertices& _vertices) {
-
-	unsigned int  it;
-	sf::FloatRect bounds;
-	float         px, py, pr, pb;
-	sf::Vector2f  position;
-
-	if (!_vertices.empty()) {
-		px = _vertices[0].position.x;
-		py = _vertices[0].position.y;
-		pr = _vertices[0].position.x;
-		pb = _vertices[0].position.y;
-
-		for (it = 1; it < _vertices.size(); ++it) {
-			position = _vertices[it].position;
-
-			if (position.x < px)
-				px = position.x;
-			else if (position.x > pr)
-				pr = position.x;
-			if (position.y < py)
-				py = position.y;
-			else if (position.y > pb)
-				pb = position.y;
-		}
-		bounds.left   = px;
-		bounds.top    = py;
-		bounds.width  = (pr - px); // * scale_width
-		bounds.height = (pb - py); // * scale_height
-	} 
-	return bounds;
-}
-/*****************************************************************************/  
-//EOF
-/*****************************************************************************/
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zhelperfuncs.cpp
+* Desc: helper functions
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include "zconsoledefs.hpp"
+#include "zhelperfuncs.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ZCONSOLE_SIMD_SSE2 1
+#include <emmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define ZCONSOLE_SIMD_SSE2 0
+#endif
+
+
+
+void 
+Zconsole_GetColorCodes(
+	unsigned int  _index,
+	unsigned int& _rgba,
+	zstring&      _cstr) {
+
+	switch (_index) {
+	case 0x0: _rgba = 0x087C00FF; _cstr = "Green";     break;
+	case 0x1: _rgba = 0x783C00FF; _cstr = "Brown";     break;
+	case 0x2: _rgba = 0xFFB000FF; _cstr = "Amber";     break;
+	case 0x3: _rgba = 0x808080FF; _cstr = "Grey";      break;
+	case 0x4: _rgba = 0x982220FF; _cstr = "Red";       break;
+	case 0x5: _rgba = 0x800080FF; _cstr = "Purple";    break;
+	case 0x6: _rgba = 0x00FFFFFF; _cstr = "Cyan";      break;
+	case 0x7: _rgba = 0xE454ECFF; _cstr = "Magenta";   break;
+	case 0x8: _rgba = 0x00FF00FF; _cstr = "Lt Green";  break;
+	case 0x9: _rgba = 0x2245FFFF; _cstr = "Blue";      break;
+	case 0xA: _rgba = 0xC0C0C0FF; _cstr = "White";     break;
+	}
+}
+
+
+int
+Zconsole_ArgToBool(
+	const zstring& _arg0) {
+
+	if (_arg0 == "enable" || 
+		_arg0 == "on"     ||
+		_arg0 == "true"   || 
+		_arg0 == "1") 
+		return 1;
+	if (_arg0 == "disable" ||
+		_arg0 == "off"     ||
+		_arg0 == "false"   || 
+		_arg0 == "0") 
+		 return 0; 
+	return -1;
+} 
+
+
+zstring 
+Zconsole_StringToLower(
+	const zstring& _strIn) { 
+
+	zstring strOut(_strIn);
+	std::transform(
+		strOut.begin(), strOut.end(), strOut.begin(), tolower);
+	return strOut;
+}
+
+
+float
+Zconsole_StringToFloat(
+	const zstring& _in) { 
+
+	float              out;
+	std::istringstream str;
+	str = std::istringstream(_in);
+	if (str >> out)
+		return out;
+	return 0.f;
+}
+
+
+unsigned long long 
+Zconsole_StringToByteCount(
+	const zstring& _in) {
+
+	unsigned long long count = 0;
+	unsigned int       index = 0;
+
+	/*
+	A decimal count with an optional k, m or g suffix, returns 0 
+	if the string is not a byte count or the count overflows:*/
+	for (; index < _in.size() && isdigit((unsigned char)_in[index]); ++index) {
+		const unsigned int digit = _in[index] - '0';
+		if (count > (ULLONG_MAX - digit) / 10)
+			return 0;
+		count = count * 10 + digit;
+	}
+	if (index == 0)
+		return 0;
+
+	zstring suffix = _in.substr(index);
+	if (!suffix.empty() && (suffix.back() == 'b' || suffix.back() == 'B'))
+		suffix.pop_back();
+	if (suffix.size() > 1)
+		return 0;
+
+	unsigned int shift;
+	switch (suffix.empty() ? 0 : tolower((unsigned char)suffix[0])) {
+	case 0:   shift = 0;  break;
+	case 'k': shift = 10; break;
+	case 'm': shift = 20; break;
+	case 'g': shift = 30; break;
+	default:  return 0;
+	}
+	if (count > (ULLONG_MAX >> shift))
+		return 0;
+	return count << shift;
+}
+
+
+unsigned int
+Zconsole_GetCharacterSize(
+	float _pixelsize) {
+
+	//glyph pages are only ever generated at these sizes, so small 
+	//changes in scale reuse the same page instead of rasterizing again
+	static const unsigned int thresholds[] = {
+		ZCONSOLE_FONTSIZEMIN, 16, 24, 32, 48, 64, 96, ZCONSOLE_FONTSIZEMAX
+	};
+	for (unsigned int threshold : thresholds) {
+		if (_pixelsize <= (float)threshold)
+			return threshold;
+	}
+	return ZCONSOLE_FONTSIZEMAX;
+}
+
+
+bool
+Zconsole_IsMonospaceFont(
+	const sf::Font& _font,
+	unsigned int    _charsize) {
+
+	/*
+	The frame sits on a grid of space advances, text that advances or
+	kerns by anything else would drift away from it. Only printable
+	ascii counts, as in the monospace test of the glyph table:*/
+	const float hspace = _font.getGlyph(L' ', _charsize, false).advance;
+	for (unsigned int a = ' '; a < ZCONSOLE_GLYPHASCII - 1; ++a) {
+		if (_font.getGlyph(a, _charsize, false).advance != hspace)
+			return false;
+		for (unsigned int b = ' '; b < ZCONSOLE_GLYPHASCII - 1; ++b) {
+			if (_font.getKerning(a, b, _charsize) != 0.f)
+				return false;
+		}
+	}
+	return true;
+}
+
+
+zstring 
+Zconsole_UintToHexString(
+	unsigned int   _hexvalue,
+	const zstring& _hexformat) {
+
+	zstring            prefix;
+	std::streamsize    width;
+	std::ostringstream conversion;
+
+	prefix = "0x";
+	/*
+	determine format:*/
+	if (_hexformat.find('n', 5) != std::string::npos)
+		prefix = "";
+	if (_hexformat.find('1', 4) != std::string::npos)
+		width = 1;
+	else if (_hexformat.find('2', 4) != std::string::npos)
+		width = 2;
+	else if (_hexformat.find('8', 4) != std::string::npos)
+		width = 8;
+	/*
+	build the string:*/
+	conversion
+		<< std::uppercase
+		<< std::right
+		<< std::setfill('0')
+		<< std::setw(width)
+		<< std::hex
+		<< _hexvalue;
+	return conversion.str();
+}
+
+
+unsigned int
+Zconsole_HexStringToUint(zstring _hexstring) {  
+	unsigned int       value;
+	std::istringstream converter;
+
+	_hexstring = Zconsole_StringToLower(_hexstring);
+	if (_hexstring.length() > 1) {
+		if (_hexstring[0] == '0' && _hexstring[1] == 'x') {
+			_hexstring.erase(_hexstring.begin());
+			_hexstring.erase(_hexstring.begin());
+		}
+	}
+	converter = std::istringstream(_hexstring);
+	converter >> std::hex >> value;
+	return value;
+}
+
+
+sf::Color 
+Zconsole_GetColorFromUint(
+	unsigned int _color) {
+
+	sf::Color color;
+	color.r = (_color & 0xFF000000) >> 0x18;
+	color.g = (_color & 0x00FF0000) >> 0x10;
+	color.b = (_color & 0x0000FF00) >> 0x08;
+	color.a = (_color & 0x000000FF);
+	return color;
+}
+
+
+zstrings 
+Zconsole_TokenizeString(
+	const zstring& _string, 
+	char           _token) {
+
+	zstrings          output;
+	std::stringstream stream;
+	std::string       tokenizedstr;
+
+	if (!_string.empty()) {
+		stream = std::stringstream(_string);
+
+		while (std::getline(stream, tokenizedstr, _token)) {
+			if (!tokenizedstr.empty())
+				output.push_back(tokenizedstr);
+		}
+	}
+	return output;
+}
+
+
+sf::FloatRect
+Zconsole_GetVerticesBounds(
+	const zvertices& _vertices) {
+
+	if (_vertices.empty())
+		return sf::FloatRect();
+	return Zconsole_GetVerticesBounds(
+		_vertices.data(), 
+		_vertices.size());
+}
+
+
+sf::FloatRect
+Zconsole_GetVerticesBounds(
+	const sf::Vertex* _vertices,
+	std::size_t       _count) {
+
+	std::size_t it = 0;
+	float       px, py, pr, pb;
+
+	if (_count == 0)
+		return sf::FloatRect();
+
+#if ZCONSOLE_SIMD_SSE2
+	//two positions per register as (x0, y0, x1, y1), sf::Vertex is not 
+	//16 byte aligned so each position is loaded as an unaligned pair
+	__m128 vmin = _mm_castpd_ps(_mm_load_sd(
+		(const double*)&_vertices[0].position));
+	vmin = _mm_movelh_ps(vmin, vmin);
+	__m128 vmax = vmin;
+
+	for (; it + 2 <= _count; it += 2) {
+		__m128 pos = _mm_castpd_ps(_mm_load_sd(
+			(const double*)&_vertices[it + 0].position));
+		pos = _mm_loadh_pi(pos, 
+			(const __m64*)&_vertices[it + 1].position);
+
+		vmin = _mm_min_ps(vmin, pos);
+		vmax = _mm_max_ps(vmax, pos);
+	}
+	//fold the upper pair onto the lower one
+	vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+	vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+
+	px = _mm_cvtss_f32(vmin);
+	py = _mm_cvtss_f32(_mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(1, 1, 1, 1)));
+	pr = _mm_cvtss_f32(vmax);
+	pb = _mm_cvtss_f32(_mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(1, 1, 1, 1)));
+#else
+	px = pr = _vertices[0].position.x;
+	py = pb = _vertices[0].position.y;
+#endif
+	//remaining vertices (or all of them without SIMD)
+	for (; it < _count; ++it) {
+		const sf::Vector2f& position = _vertices[it].position;
+
+		px = std::min(px, position.x);
+		py = std::min(py, position.y);
+		pr = std::max(pr, position.x);
+		pb = std::max(pb, position.y);
+	}
+	return sf::FloatRect(px, py, pr - px, pb - py);
+}
+
+
+static void
+Zconsole_FormatAppend(
+	zformat&    _line,
+	const char* _text,
+	std::size_t _size) {
+
+	//the line is truncated once the buffer is full
+	const std::size_t room = zformat::capacity - _line.size;
+	if (_size > room)
+		_size = room;
+	memcpy(_line.text + _line.size, _text, _size);
+	_line.size += _size;
+}
+
+
+static void
+Zconsole_FormatPad(
+	zformat&    _line,
+	std::size_t _length) {
+
+	while (_length < _line.width && _line.size < zformat::capacity) {
+		_line.text[_line.size++] = _line.fill;
+		++_length;
+	}
+}
+
+
+static void
+Zconsole_FormatNumber(
+	zformat&    _line,
+	const char* _digits,
+	std::size_t _size,
+	bool        _negative) {
+
+	//zero padding goes between the sign and the digits
+	const std::size_t length = _size + (_negative ? 1 : 0);
+	if (_line.fill != '0')
+		Zconsole_FormatPad(_line, length);
+	if (_negative)
+		Zconsole_FormatAppend(_line, "-", 1);
+	if (_line.fill == '0')
+		Zconsole_FormatPad(_line, length);
+	Zconsole_FormatAppend(_line, _digits, _size);
+}
+
+
+bool
+Zconsole_FormatNext(
+	zformat&  _line,
+	zstrview& _format) {
+
+	_line.width     = 0;
+	_line.precision = -1;
+	_line.fill      = ' ';
+	_line.type      = 0;
+
+	while (!_format.empty()) {
+		const std::size_t brace = _format.find_first_of("{}");
+		Zconsole_FormatAppend(_line, _format.data(), 
+			brace == zstrview::npos ? _format.size() : brace);
+		if (brace == zstrview::npos)
+			break;
+		_format.remove_prefix(brace);
+
+		//doubled braces print a single brace
+		if (_format.size() > 1 && _format[1] == _format[0]) {
+			Zconsole_FormatAppend(_line, _format.data(), 1);
+			_format.remove_prefix(2);
+			continue;
+		}
+		//a brace that does not open a placeholder is printed as is
+		const std::size_t close = _format.find('}');
+		if (_format[0] == '}' || close == zstrview::npos ||
+			(close > 1 && _format[1] != ':')) {
+			Zconsole_FormatAppend(_line, _format.data(), 1);
+			_format.remove_prefix(1);
+			continue;
+		}
+
+		//field options follow a colon: [0][width][.decimals][x|X]
+		zstrview options = _format.substr(1, close - 1);
+		_format.remove_prefix(close + 1);
+		if (!options.empty()) {
+			options.remove_prefix(1);
+			if (!options.empty() && options[0] == '0') {
+				_line.fill = '0';
+				options.remove_prefix(1);
+			}
+			while (!options.empty() && options[0] >= '0' && options[0] <= '9') {
+				_line.width = _line.width * 10 + (options[0] - '0');
+				options.remove_prefix(1);
+			}
+			if (!options.empty() && options[0] == '.') {
+				options.remove_prefix(1);
+				_line.precision = 0;
+				while (!options.empty() && options[0] >= '0' && options[0] <= '9') {
+					_line.precision = _line.precision * 10 + (options[0] - '0');
+					options.remove_prefix(1);
+				}
+			}
+			if (!options.empty() && (options[0] == 'x' || options[0] == 'X'))
+				_line.type = options[0];
+		}
+		return true;
+	}
+	_format = zstrview();
+	return false;
+}
+
+
+void
+Zconsole_FormatText(
+	zformat& _line,
+	zstrview _text) {
+
+	Zconsole_FormatAppend(_line, _text.data(), _text.size());
+	Zconsole_FormatPad(_line, _text.size());
+}
+
+
+void
+Zconsole_FormatInteger(
+	zformat&           _line,
+	unsigned long long _magnitude,
+	bool               _negative) {
+
+	const char* const  symbols = 
+		_line.type == 'x' ? "0123456789abcdef" : "0123456789ABCDEF";
+	const unsigned int base    = _line.type != 0 ? 16 : 10;
+
+	//digits are produced from the lowest one, right to left
+	char  digits[24];
+	char* first = digits + sizeof(digits);
+	do {
+		*--first    = symbols[_magnitude % base];
+		_magnitude /= base;
+	} while (_magnitude != 0);
+
+	Zconsole_FormatNumber(
+		_line, first, digits + sizeof(digits) - first, _negative);
+}
+
+
+void
+Zconsole_FormatFloat(
+	zformat& _line,
+	double   _value) {
+
+	char digits[32];
+	int  size = _line.precision < 0 ?
+		snprintf(digits, sizeof(digits), "%g", _value) :
+		snprintf(digits, sizeof(digits), "%.*f", _line.precision, _value);
+	if (size <= 0)
+		return;
+	if (size >= (int)sizeof(digits))
+		size = (int)sizeof(digits) - 1;
+
+	const bool negative = digits[0] == '-';
+	Zconsole_FormatNumber(_line, 
+		digits + (negative ? 1 : 0), size - (negative ? 1 : 0), negative);
+}
+
+
+static inline char 
+Zconsole_LowerChar(
+	char _char) {
+
+	return (_char >= 'A' && _char <= 'Z') ? (char)(_char + 0x20) : _char;
+}
+
+
+static bool 
+Zconsole_MatchesAt(
+	const char*  _text, 
+	const char*  _pattern, 
+	unsigned int _length) {
+
+	for (unsigned int i = 0; i < _length; ++i) {
+		if (Zconsole_LowerChar(_text[i]) != _pattern[i])
+			return false;
+	}
+	return true;
+}
+
+
+#if ZCONSOLE_SIMD_SSE2
+static inline __m128i 
+Zconsole_LowerChars(
+	__m128i _chars) {
+
+	//'A'..'Z' gain bit 5, bytes >= 0x80 compare as negative and are left alone
+	const __m128i upper = _mm_and_si128(
+		_mm_cmpgt_epi8(_chars, _mm_set1_epi8('A' - 1)),
+		_mm_cmplt_epi8(_chars, _mm_set1_epi8('Z' + 1)));
+	return _mm_or_si128(_chars, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+
+static inline unsigned int 
+Zconsole_LowestBit(
+	unsigned int _mask) {
+
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, _mask);
+	return (unsigned int)index;
+#else
+	return (unsigned int)__builtin_ctz(_mask);
+#endif
+}
+#endif
+
+
+bool
+Zconsole_FindSubstring(
+	const char*   _text,
+	unsigned int  _size,
+	const char*   _pattern,
+	unsigned int  _length,
+	unsigned int& _offset) {
+
+	if (_length == 0 || _length > _size)
+		return false;
+
+	//the pattern is lowercase, the text is matched ignoring case
+	const unsigned int last  = _size - _length;
+	unsigned int       index = 0;
+
+#if ZCONSOLE_SIMD_SSE2
+	/*
+	Compare the first and the last character of the pattern against 16 
+	positions at once, only positions where both match are verified:*/
+	const __m128i head = _mm_set1_epi8(_pattern[0]);
+	const __m128i tail = _mm_set1_epi8(_pattern[_length - 1]);
+
+	for (; index + 16 <= last + 1; index += 16) {
+		const __m128i first = Zconsole_LowerChars(_mm_loadu_si128(
+			(const __m128i*)(_text + index)));
+		const __m128i final = Zconsole_LowerChars(_mm_loadu_si128(
+			(const __m128i*)(_text + index + _length - 1)));
+
+		unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(
+			_mm_cmpeq_epi8(first, head), 
+			_mm_cmpeq_epi8(final, tail)));
+
+		while (mask != 0) {
+			const unsigned int candidate = index + Zconsole_LowestBit(mask);
+			if (Zconsole_MatchesAt(_text + candidate, _pattern, _length)) {
+				_offset = candidate;
+				return true;
+			}
+			mask &= mask - 1;
+		}
+	}
+#endif
+	//remaining positions (or all of them without SIMD)
+	for (; index <= last; ++index) {
+		if (Zconsole_LowerChar(_text[index]) == _pattern[0] &&
+			Zconsole_MatchesAt(_text + index, _pattern, _length)) {
+			_offset = index;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/*
+Block compression, a byte oriented LZ77 in the spirit of LZ4. A block
+is a run of sequences, each one made of a token, literal bytes and a
+back reference to up to 64KB earlier in the block:
+
+	token   : literal count (high nibble), match length - 4 (low nibble), 
+	          15 in a nibble means extra length bytes follow (255 = more)
+	literals: copied as is
+	offset  : 2 bytes little endian, absent from the last sequence
+	
+Scrollback text is repetitive enough that this cheap scheme does well,
+and decoding is a plain copy loop.*/
+#define ZCOMPRESS_HASHBITS  12
+#define ZCOMPRESS_MINMATCH  4
+#define ZCOMPRESS_MAXOFFSET 0xFFFF
+#define ZCOMPRESS_TAILSIZE  5 //last bytes are always stored as literals
+
+
+static unsigned int 
+Zconsole_HashBytes(
+	const unsigned char* _bytes) {
+
+	unsigned int value;
+	memcpy(&value, _bytes, sizeof(value));
+	return (value * 2654435761U) >> (32 - ZCOMPRESS_HASHBITS);
+}
+
+
+static unsigned char* 
+Zconsole_WriteLength(
+	unsigned char* _dest, 
+	unsigned int   _length) {
+
+	for (; _length >= 255; _length -= 255)
+		*_dest++ = 255;
+	*_dest++ = (unsigned char)_length;
+	return _dest;
+}
+
+
+static unsigned char*
+Zconsole_WriteSequence(
+	unsigned char*       _dest,
+	const unsigned char* _literals,
+	unsigned int         _literalcount,
+	unsigned int         _offset,
+	unsigned int         _matchlength) {
+
+	unsigned char* token = _dest++;
+	unsigned int   match = _matchlength - ZCOMPRESS_MINMATCH;
+
+	*token = (unsigned char)(std::min(_literalcount, 15u) << 4);
+	if (_literalcount >= 15)
+		_dest = Zconsole_WriteLength(_dest, _literalcount - 15);
+	memcpy(_dest, _literals, _literalcount);
+	_dest += _literalcount;
+
+	//the last sequence only holds literals
+	if (_matchlength == 0)
+		return _dest;
+
+	*token |= (unsigned char)std::min(match, 15u);
+	*_dest++ = (unsigned char)(_offset & 0xFF);
+	*_dest++ = (unsigned char)(_offset >> 8);
+	if (match >= 15)
+		_dest = Zconsole_WriteLength(_dest, match - 15);
+	return _dest;
+}
+
+
+unsigned int
+Zconsole_CompressBound(
+	unsigned int _size) {
+
+	return _size + _size / 255 + 16;
+}
+
+
+unsigned int
+Zconsole_CompressBlock(
+	const unsigned char* _source,
+	unsigned int         _size,
+	unsigned char*       _dest) {
+
+	//positions are stored + 1, zero marks an empty slot
+	unsigned int table[1 << ZCOMPRESS_HASHBITS];
+	memset(table, 0, sizeof(table));
+
+	unsigned char* dest   = _dest;
+	unsigned int   anchor = 0;
+	unsigned int   index  = 0;
+
+	if (_size > ZCOMPRESS_TAILSIZE + ZCOMPRESS_MINMATCH) {
+		const unsigned int limit = _size - ZCOMPRESS_TAILSIZE;
+
+		while (index + ZCOMPRESS_MINMATCH <= limit) {
+			const unsigned int hash      = Zconsole_HashBytes(_source + index);
+			const unsigned int candidate = table[hash];
+			table[hash] = index + 1;
+
+			if (candidate == 0 || 
+				index - (candidate - 1) > ZCOMPRESS_MAXOFFSET ||
+				memcmp(_source + candidate - 1, _source + index, ZCOMPRESS_MINMATCH) != 0) {
+				++index;
+				continue;
+			}
+			const unsigned int origin = candidate - 1;
+
+			unsigned int length = ZCOMPRESS_MINMATCH;
+			while (index + length < limit && 
+				   _source[origin + length] == _source[index + length])
+				++length;
+
+			dest = Zconsole_WriteSequence(
+				dest, 
+				_source + anchor, 
+				index - anchor, 
+				index - origin, 
+				length);
+			index += length;
+			anchor = index;
+		}
+	}
+	dest = Zconsole_WriteSequence(
+		dest, _source + anchor, _size - anchor, 0, 0);
+	return (unsigned int)(dest - _dest);
+}
+
+
+bool
+Zconsole_DecompressBlock(
+	const unsigned char* _source,
+	unsigned int         _size,
+	unsigned char*       _dest,
+	unsigned int         _destsize) {
+
+	const unsigned char* source = _source;
+	const unsigned char* end    = _source + _size;
+	unsigned int         length = 0;
+
+	while (source < end) {
+		const unsigned int token = *source++;
+
+		/*
+		Literals, followed by a match unless the block ends:*/
+		unsigned int count = token >> 4;
+		if (count == 15) {
+			unsigned char extra;
+			do {
+				if (source == end)
+					return false;
+				extra  = *source++;
+				count += extra;
+			} while (extra == 255);
+		}
+		if ((unsigned int)(end - source) < count || _destsize - length < count)
+			return false;
+		memcpy(_dest + length, source, count);
+		source += count;
+		length += count;
+
+		if (source == end)
+			break;
+		if (end - source < 2)
+			return false;
+		const unsigned int offset = source[0] | (source[1] << 8);
+		source += 2;
+
+		count = (token & 15) + ZCOMPRESS_MINMATCH;
+		if ((token & 15) == 15) {
+			unsigned char extra;
+			do {
+				if (source == end)
+					return false;
+				extra  = *source++;
+				count += extra;
+			} while (extra == 255);
+		}
+		if (offset == 0 || offset > length || _destsize - length < count)
+			return false;
+
+		//an overlapping match repeats its bytes, copy those one by one
+		const unsigned char* match = _dest + length - offset;
+		if (offset >= count)
+			memcpy(_dest + length, match, count);
+		else {
+			for (unsigned int n = 0; n < count; ++n)
+				_dest[length + n] = match[n];
+		}
+		length += count;
+	}
+	return length == _destsize;
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/
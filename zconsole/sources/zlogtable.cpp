@@ -0,0 +1,106 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zlogtable.cpp
+* Desc: table of deferred log formats
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#include <cstdint>
+#include "zconsoledefs.hpp"
+#include "zlogtable.hpp"
+
+
+
+/* Section 1:
+** public interface functions
+******************************************************************************/
+Zconsole::ZlogTable::ZlogTable() :
+	m_slots(ZCONSOLE_LOGSITES * 2, 0u) {
+	m_sites.reserve(ZCONSOLE_LOGSITES);
+}
+
+
+unsigned int 
+Zconsole::ZlogTable::getSite(
+	zstrview    _format, 
+	zlogdecoder _decoder) {
+
+	const std::uintptr_t key = 
+		reinterpret_cast<std::uintptr_t>(_format.data()) ^
+		reinterpret_cast<std::uintptr_t>(_decoder) * 31u;
+
+	/*
+	Open addressing over twice as many slots as sites, so a probe
+	ends on a free slot quickly:*/
+	const unsigned int mask = (unsigned int)m_slots.size() - 1u;
+	unsigned int slot = 
+		(unsigned int)((key * 0x9E3779B97F4A7C15ull) >> 40) & mask;
+	for (;;) {
+		const unsigned int id = m_slots[slot];
+		if (id == 0)
+			break;
+		const Site& site = m_sites[id - 1];
+		if (site.address == _format.data() && 
+			site.decoder == _decoder && 
+			site.format  == _format)
+			return id - 1;
+		slot = (slot + 1) & mask;
+	}
+	if (m_sites.size() >= ZCONSOLE_LOGSITES)
+		return ZCONSOLE_LOGSITES;
+
+	Site site;
+	site.address = _format.data();
+	site.format.assign(_format.data(), _format.size());
+	site.decoder = _decoder;
+	m_sites.push_back(std::move(site));
+	m_slots[slot] = (unsigned int)m_sites.size();
+	return m_slots[slot] - 1;
+}
+
+
+void 
+Zconsole::ZlogTable::format(
+	unsigned int         _site, 
+	const unsigned char* _args, 
+	zformat&             _line) const {
+
+	if (_site >= m_sites.size()) {
+		_line.size = 0;
+		return;
+	}
+	const Site& site = m_sites[_site];
+	site.decoder(_line, site.format, _args);
+
+	//the line is a single row, a break in an argument must not split it
+	for (std::size_t i = 0; i < _line.size; ++i) {
+		if (_line.text[i] == '\n' || _line.text[i] == '\r')
+			_line.text[i] = ' ';
+	}
+}
+
+
+unsigned int Zconsole::ZlogTable::getSiteCount() const {
+	return (unsigned int)m_sites.size();
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
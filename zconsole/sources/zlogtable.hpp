@@ -0,0 +1,77 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zlogtable.hpp
+* Desc: table of deferred log formats
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#ifndef __ZLOGTABLE_HPP__
+#define __ZLOGTABLE_HPP__
+
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::ZlogTable final : sf::NonCopyable {
+public: 
+	ZlogTable();
+	~ZlogTable() {}	
+
+	/*
+	Returns the id of a log site, a format and the decoder of its 
+	argument types. A site is registered the first time it is seen
+	and keeps a copy of the format. Lookups hash the two addresses,
+	then compare the text so a reused buffer never aliases a site.
+	@_format : the format text
+	@_decoder: formats the line from its arguments
+	@return  : the id of the site, or ZCONSOLE_LOGSITES if the table
+	           is full*/
+	unsigned int getSite(zstrview _format, zlogdecoder _decoder);
+
+	/*
+	Format a log line from its site and the raw bytes of its arguments
+	@_site: the id of the site
+	@_args: the raw bytes of the arguments
+	@_line: receives the formatted line, line breaks become spaces*/
+	void format(
+		unsigned int         _site, 
+		const unsigned char* _args, 
+		zformat&             _line) const;
+
+	/*
+	Returns the number of registered sites*/
+	unsigned int getSiteCount() const;
+
+private:
+	/*
+	A log call site*/
+	struct Site {
+		const char* address; //the format text as logged
+		zstring     format;  //a copy of the format text
+		zlogdecoder decoder; //formats the arguments
+	};
+
+	std::vector<Site>         m_sites; //registered sites, by id
+	std::vector<unsigned int> m_slots; //hash slots, site id + 1 or 0 if free
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -0,0 +1,99 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zprintqueue.cpp
+* Desc: lock-free queue of lines printed from other threads
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#include <cstring>
+#include "zconsoledefs.hpp"
+#include "zprintqueue.hpp"
+
+
+
+/* Section 1:
+** public interface functions
+******************************************************************************/
+Zconsole::ZprintQueue::ZprintQueue(unsigned int _capacity) :
+	m_cells(new Cell[_capacity]),
+	m_mask(_capacity - 1),
+	m_enqueue(0),
+	m_dropped(0),
+	m_dequeue(0),
+	m_reported(0) {
+
+	for (unsigned int i = 0; i < _capacity; ++i)
+		m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+
+bool Zconsole::ZprintQueue::push(zstrview _text) {
+	unsigned int position = m_enqueue.load(std::memory_order_relaxed);
+
+	/*
+	Claim the cell at the write position. A cell still holding a line
+	of the previous round means the queue is full, a cell already 
+	claimed by another producer means the position is stale:*/
+	Cell* cell;
+	for (;;) {
+		cell = &m_cells[position & m_mask];
+		const unsigned int sequence = 
+			cell->sequence.load(std::memory_order_acquire);
+		const int turn = (int)(sequence - position);
+
+		if (turn == 0) {
+			if (m_enqueue.compare_exchange_weak(
+				position, position + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (turn < 0) {
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else position = m_enqueue.load(std::memory_order_relaxed);
+	}
+
+	const std::size_t size = 
+		_text.size() < ZCONSOLE_QUEUELINE ? _text.size() : ZCONSOLE_QUEUELINE;
+	if (size != 0)
+		memcpy(cell->text, _text.data(), size);
+	cell->size = (unsigned int)size;
+
+	//publish the line to the consumer
+	cell->sequence.store(position + 1, std::memory_order_release);
+	return true;
+}
+
+
+unsigned int Zconsole::ZprintQueue::takeDropped() {
+	const unsigned int dropped = m_dropped.load(std::memory_order_relaxed);
+	const unsigned int count   = dropped - m_reported;
+	m_reported = dropped;
+	return count;
+}
+
+
+unsigned int Zconsole::ZprintQueue::getDroppedCount() const {
+	return m_dropped.load(std::memory_order_relaxed);
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
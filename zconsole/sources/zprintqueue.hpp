@@ -0,0 +1,112 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zprintqueue.hpp
+* Desc: lock-free queue of lines printed from other threads
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#ifndef __ZPRINTQUEUE_HPP__
+#define __ZPRINTQUEUE_HPP__
+
+#include <atomic>
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::ZprintQueue final : sf::NonCopyable {
+public: 
+	/*
+	@_capacity: the number of lines the queue holds, a power of two*/
+	ZprintQueue(unsigned int _capacity);
+	~ZprintQueue() {}	
+
+	/*
+	Queue a line, any thread may call this. Producers claim a cell 
+	with a single compare and swap and never wait on the consumer, 
+	when every cell is taken the line is dropped and counted.
+	@_text : the text of the line, cut to ZCONSOLE_QUEUELINE characters
+	@return: true if the line was queued, false if it was dropped*/
+	bool push(zstrview _text);
+
+	/*
+	Hand the queued lines to a function, oldest first, on the thread
+	that owns the console. Lines queued while draining are left for 
+	the next call, so a busy producer cannot keep the drain running.
+	@_sink : called as _sink(const char* _text, unsigned int _size), 
+	         the text is only valid during the call
+	@return: the number of lines drained*/
+	template <typename Sink>
+	unsigned int drain(Sink&& _sink);
+
+	/*
+	Returns the number of lines dropped since the last call,
+	on the thread that owns the console*/
+	unsigned int takeDropped();
+
+	/*
+	Returns the number of lines dropped since the queue was created*/
+	unsigned int getDroppedCount() const;
+
+private:
+	/*
+	A queued line. The sequence tells whose turn it is: the position 
+	a producer may write at, that position + 1 once the line is ready
+	to be read, then the position of the next round*/
+	struct Cell {
+		std::atomic<unsigned int> sequence; 
+		unsigned int              size;     
+		char                      text[ZCONSOLE_QUEUELINE];
+	};
+
+	std::unique_ptr<Cell[]>   m_cells;    //the ring of cells
+	unsigned int              m_mask;     //capacity - 1
+	alignas(64) 
+	std::atomic<unsigned int> m_enqueue;  //next position to write, shared
+	std::atomic<unsigned int> m_dropped;  //lines dropped while full
+	alignas(64) 
+	unsigned int              m_dequeue;  //next position to read
+	unsigned int              m_reported; //dropped lines already taken
+};
+
+
+
+template <typename Sink>
+unsigned int Zconsole::ZprintQueue::drain(Sink&& _sink) {
+	const unsigned int last = m_enqueue.load(std::memory_order_acquire);
+
+	unsigned int count = 0;
+	while (m_dequeue != last) {
+		Cell& cell = m_cells[m_dequeue & m_mask];
+
+		//a producer claimed this cell but has not finished writing it
+		if (cell.sequence.load(std::memory_order_acquire) != m_dequeue + 1)
+			break;
+
+		_sink(cell.text, cell.size);
+		cell.sequence.store(m_dequeue + m_mask + 1, std::memory_order_release);
+		++m_dequeue;
+		++count;
+	}
+	return count;
+}
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
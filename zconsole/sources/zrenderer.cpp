@@ -0,0 +1,453 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zrenderer.cpp
+* Desc: interface for console rendering backends
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/  
+#include "zconsoledefs.hpp"
+#include "zhelperfuncs.hpp"
+#include "zglyphtable.hpp"
+#include "zscreen.hpp"
+#include "zrenderer.hpp"
+#include "zvertexarena.hpp"
+
+
+
+
+/* Section 1:
+** internal data
+******************************************************************************/
+#define CELLGRID_ATLASCOLUMNS 32 //number of glyph slots per atlas row
+
+
+/*
+Draws the whole console from a single quad: every fragment looks up
+its cell in the data textures, then samples the glyph atlas slot*/
+static const char* s_cellgrid_shader =
+	"uniform sampler2D cells;                                            \n"
+	"uniform sampler2D colors;                                           \n"
+	"uniform sampler2D atlas;                                            \n"
+	"uniform vec2      gridsize;                                         \n"
+	"uniform vec2      atlasgrid;                                        \n"
+	"uniform vec2      slotsize;                                         \n"
+	"void main() {                                                       \n"
+	"    vec2  position = gl_TexCoord[0].xy * gridsize;                  \n"
+	"    vec2  texel    = (floor(position) + 0.5) / gridsize;            \n"
+	"    vec4  data     = texture2D(cells, texel);                       \n"
+	"    float slot     = floor(data.r * 255.0 + 0.5) +                  \n"
+	"                     floor(data.g * 255.0 + 0.5) * 256.0;           \n"
+	"    vec2  origin   = vec2(mod(slot, atlasgrid.x),                   \n"
+	"                          floor(slot / atlasgrid.x));               \n"
+	"    vec2  local    = clamp(fract(position),                         \n"
+	"                           0.5 / slotsize, 1.0 - 0.5 / slotsize);   \n"
+	"    float coverage = texture2D(atlas, (origin + local) / atlasgrid).a;\n"
+	"    vec4  color    = texture2D(colors, texel);                      \n"
+	"    gl_FragColor   = vec4(color.rgb * coverage * color.a, 1.0);     \n"
+	"}                                                                   \n";
+
+
+
+
+/* Section 2:
+** internal interface functions
+******************************************************************************/
+bool Zconsole::Zrenderer::buildCellGrid() {
+	const auto& glyphs = *m_lpconsole->m_glyphtable;
+
+	sf::RenderTexture target;
+	zvertices         quads;
+	unsigned int      index, rows;
+	float             top, px, py, pr, pb, ux, uy, ur, ub, cx, cy;
+
+	if (!sf::Shader::isAvailable())
+		return false;
+	if (!m_shader.loadFromMemory(s_cellgrid_shader, sf::Shader::Fragment))
+		return false;
+	/*
+	Every atlas slot is one console cell, 
+	with the baseline placed below the tallest glyph:*/
+	top = 0.f;
+	for (index = 0; index < glyphs.size(); ++index) {
+		top = std::min(top, glyphs.getGlyphAt(index).bounds.top);
+	}
+	m_baseline   = ceil(-top);
+	m_cellsize.x = glyphs.getGlyph(' ').advance;
+	m_cellsize.y = glyphs.getLineSpacing();
+
+	const unsigned int slotw = (unsigned int)ceil(m_cellsize.x);
+	const unsigned int sloth = (unsigned int)ceil(m_cellsize.y);
+
+	rows = (glyphs.size() + CELLGRID_ATLASCOLUMNS - 1) / CELLGRID_ATLASCOLUMNS;
+	if (!target.create(slotw * CELLGRID_ATLASCOLUMNS, sloth * rows))
+		return false;
+	/*
+	Write a quad for every glyph, clipped to its own slot:*/
+	for (index = 0; index < glyphs.size(); ++index) {
+		const sf::Glyph& glyph = glyphs.getGlyphAt(index);
+
+		cx = (float)((index % CELLGRID_ATLASCOLUMNS) * slotw);
+		cy = (float)((index / CELLGRID_ATLASCOLUMNS) * sloth);
+
+		px = cx + glyph.bounds.left;
+		py = cy + glyph.bounds.top + m_baseline;
+		pr = px + glyph.bounds.width;
+		pb = py + glyph.bounds.height;
+
+		ux = (float)(glyph.textureRect.left);
+		uy = (float)(glyph.textureRect.top);
+		ur = (float)(ux + glyph.textureRect.width);
+		ub = (float)(uy + glyph.textureRect.height);
+
+		if (pr <= px || pb <= py)
+			continue;
+		{//clip to the slot, adjusting the texture coordinates to match
+			const float sx = (ur - ux) / (pr - px);
+			const float sy = (ub - uy) / (pb - py);
+
+			if (px < cx)         { ux += (cx - px) * sx;         px = cx; }
+			if (py < cy)         { uy += (cy - py) * sy;         py = cy; }
+			if (pr > cx + slotw) { ur -= (pr - cx - slotw) * sx; pr = cx + slotw; }
+			if (pb > cy + sloth) { ub -= (pb - cy - sloth) * sy; pb = cy + sloth; }
+		}
+		quads.push_back(sf::Vertex({ px, py }, { ux, uy }));
+		quads.push_back(sf::Vertex({ pr, py }, { ur, uy }));
+		quads.push_back(sf::Vertex({ px, pb }, { ux, ub }));
+		quads.push_back(sf::Vertex({ px, pb }, { ux, ub }));
+		quads.push_back(sf::Vertex({ pr, py }, { ur, uy }));
+		quads.push_back(sf::Vertex({ pr, pb }, { ur, ub }));
+	}
+	target.clear(sf::Color::Transparent);
+	target.draw(
+		quads.data(), 
+		quads.size(), 
+		sf::Triangles, 
+		&glyphs.getTexture());
+	target.display();
+	/*
+	Go through an image, so the atlas is not stored upside down:*/
+	if (!m_atlas.loadFromImage(target.getTexture().copyToImage()))
+		return false;
+	m_atlas.setSmooth(true);
+
+	if (!m_cells.create(ZCONSOLE_WIDTH, ZCONSOLE_HEIGHT) ||
+		!m_colors.create(ZCONSOLE_WIDTH, ZCONSOLE_HEIGHT))
+		return false;
+	m_cells.setSmooth(false);
+	m_colors.setSmooth(false);
+	m_cellpixels.assign(ZCONSOLE_TOTALSIZE * 4, 0);
+	m_colorpixels.assign(ZCONSOLE_TOTALSIZE * 4, 0);
+
+	m_shader.setUniform("cells",  sf::Shader::CurrentTexture);
+	m_shader.setUniform("colors", m_colors);
+	m_shader.setUniform("atlas",  m_atlas);
+	m_shader.setUniform("gridsize", 
+		sf::Glsl::Vec2(ZCONSOLE_WIDTH, ZCONSOLE_HEIGHT));
+	m_shader.setUniform("atlasgrid", 
+		sf::Glsl::Vec2((float)CELLGRID_ATLASCOLUMNS, (float)rows));
+	m_shader.setUniform("slotsize", 
+		sf::Glsl::Vec2((float)slotw, (float)sloth));
+	/*
+	The quad spans the grid, texture coordinates address the cells:*/
+	px = 0.f;
+	py = m_lpconsole->m_charsize - m_baseline;
+	pr = px + m_cellsize.x * ZCONSOLE_WIDTH;
+	pb = py + m_cellsize.y * ZCONSOLE_HEIGHT;
+	ur = (float)ZCONSOLE_WIDTH;
+	ub = (float)ZCONSOLE_HEIGHT;
+
+	m_gridquad[0] = sf::Vertex({ px, py }, { 0.f, 0.f });
+	m_gridquad[1] = sf::Vertex({ pr, py }, { ur,  0.f });
+	m_gridquad[2] = sf::Vertex({ px, pb }, { 0.f, ub  });
+	m_gridquad[3] = sf::Vertex({ px, pb }, { 0.f, ub  });
+	m_gridquad[4] = sf::Vertex({ pr, py }, { ur,  0.f });
+	m_gridquad[5] = sf::Vertex({ pr, pb }, { ur,  ub  });
+	return true;
+}
+
+
+void Zconsole::Zrenderer::presentCellGrid(
+	sf::RenderTarget&       _rendertarget,
+	const sf::RenderStates& _renderstates) {
+
+	sf::RenderStates states(_renderstates);
+	states.texture = &m_cells;
+	states.shader  = &m_shader;
+	_rendertarget.draw(m_gridquad, 6, sf::Triangles, states);
+}
+
+
+
+
+void Zconsole::Zrenderer::draw(
+	sf::RenderTarget&       _rendertarget,
+	const sf::RenderStates& _renderstates) {
+
+	const auto& vertices = *m_lpconsole->m_vertices;
+
+	switch (m_mode) {
+	case ZRENDER_CELLGRID:
+		presentCellGrid(_rendertarget, _renderstates);
+		return;
+	case ZRENDER_VERTEXBUFFER:
+		uploadVertexBuffer();
+		if (m_buffer.getVertexCount() == vertices.size()) {
+			_rendertarget.draw(m_buffer, _renderstates);
+			return;
+		}
+		break;
+	case ZRENDER_VERTEXARRAY:
+		break;
+	}
+	_rendertarget.draw(
+		vertices.data(),
+		vertices.size(),
+		sf::Triangles,
+		_renderstates);
+}
+
+
+sf::FloatRect Zconsole::Zrenderer::getBounds() const {
+	const auto& vertices = *m_lpconsole->m_vertices;
+
+	//the background quad (or the grid quad) spans the whole console
+	const sf::Vertex* quad = 
+		m_mode == ZRENDER_CELLGRID ? m_gridquad : vertices.data();
+
+	return sf::FloatRect(
+		quad[0].position.x,
+		quad[0].position.y,
+		quad[5].position.x - quad[0].position.x,
+		quad[5].position.y - quad[0].position.y);
+}
+
+
+bool Zconsole::Zrenderer::updateCache(const sf::RenderStates& _renderstates) {
+	const sf::FloatRect bounds = getBounds();
+	const float         scale  = m_lpconsole->getLayoutScale();
+
+	const sf::Vector2u size(
+		(unsigned int)ceil(bounds.width * scale),
+		(unsigned int)ceil(bounds.height * scale));
+
+	if (size.x == 0 || size.y == 0)
+		return false;
+
+	if (m_cache.getSize() != size) {
+		if (!m_cache.create(size.x, size.y)) {
+			m_caching = false;
+			return false;
+		}
+		m_cache.setSmooth(true);
+		m_cachevalid = false;
+	}
+	if (!m_cachevalid) {
+		/*
+		Draw the console into the cache at its final pixel size,
+		the view does the scaling in place of the transform:*/
+		m_cache.setView(sf::View(bounds));
+		m_cache.clear(sf::Color::Transparent);
+		draw(m_cache, sf::RenderStates(_renderstates.texture));
+		m_cache.display();
+
+		const float px = bounds.left;
+		const float py = bounds.top;
+		const float pr = bounds.left + bounds.width;
+		const float pb = bounds.top + bounds.height;
+		const float ur = (float)size.x;
+		const float ub = (float)size.y;
+
+		m_cachequad[0] = sf::Vertex({ px, py }, { 0.f, 0.f });
+		m_cachequad[1] = sf::Vertex({ pr, py }, { ur,  0.f });
+		m_cachequad[2] = sf::Vertex({ px, pb }, { 0.f, ub  });
+		m_cachequad[3] = sf::Vertex({ px, pb }, { 0.f, ub  });
+		m_cachequad[4] = sf::Vertex({ pr, py }, { ur,  0.f });
+		m_cachequad[5] = sf::Vertex({ pr, pb }, { ur,  ub  });
+		m_cachevalid = true;
+	}
+	return true;
+}
+
+
+
+
+/* Section 3:
+** public interface functions
+******************************************************************************/
+void Zconsole::Zrenderer::initialize() {
+	m_mode    = ZRENDER_VERTEXARRAY;
+	m_caching = false;
+	invalidate();
+}
+
+
+bool Zconsole::Zrenderer::setMode(zrendermode _mode) {
+	m_mode = ZRENDER_VERTEXARRAY;
+
+	switch (_mode) {
+	case ZRENDER_VERTEXBUFFER:
+		if (!sf::VertexBuffer::isAvailable())
+			return false;
+		m_mode = _mode;
+		break;
+	case ZRENDER_CELLGRID:
+		if (!buildCellGrid())
+			return false;
+		m_mode = _mode;
+		break;
+	case ZRENDER_VERTEXARRAY:
+		break;
+	}
+	//a new backend starts without a copy of the vertices
+	invalidate();
+	return m_mode == _mode;
+}
+
+
+zrendermode Zconsole::Zrenderer::getMode() const {
+	return m_mode;
+}
+
+
+void Zconsole::Zrenderer::invalidate(unsigned int _first, unsigned int _count) {
+	if (_count == 0) 
+		return;
+
+	m_cachevalid = false;
+
+	if (m_dirtyfirst >= m_dirtylast) {
+		m_dirtyfirst = _first;
+		m_dirtylast  = _first + _count;
+	}
+	else {
+		m_dirtyfirst = std::min(m_dirtyfirst, _first);
+		m_dirtylast  = std::max(m_dirtylast, _first + _count);
+	}
+}
+
+
+void Zconsole::Zrenderer::invalidate() {
+	m_cachevalid = false;
+	m_dirtyfirst = 0;
+	m_dirtylast  = m_lpconsole->m_vertices->size();
+}
+
+
+void Zconsole::Zrenderer::updateCells(unsigned int _coordy) {
+	const auto& glyphs = *m_lpconsole->m_glyphtable;
+	const auto* cells  = 
+		m_lpconsole->m_screen->getCellMatrix() + (_coordy * ZCONSOLE_WIDTH);
+
+	sf::Uint8* const slots  = &m_cellpixels[_coordy * ZCONSOLE_WIDTH * 4];
+	sf::Uint8* const colors = &m_colorpixels[_coordy * ZCONSOLE_WIDTH * 4];
+
+	for (unsigned int x = 0; x < ZCONSOLE_WIDTH; ++x) {
+		int slot = glyphs.getIndex(cells[x].mchar);
+		if (slot < 0) 
+			slot = glyphs.getIndex(' ');
+
+		const sf::Color color = Zconsole_GetColorFromUint(cells[x].color);
+
+		slots[x * 4 + 0] = (sf::Uint8)(slot & 0xFF);
+		slots[x * 4 + 1] = (sf::Uint8)(slot >> 8);
+		slots[x * 4 + 2] = 0;
+		slots[x * 4 + 3] = 0xFF;
+
+		colors[x * 4 + 0] = color.r;
+		colors[x * 4 + 1] = color.g;
+		colors[x * 4 + 2] = color.b;
+		colors[x * 4 + 3] = color.a;
+	}
+	m_cells.update(slots, ZCONSOLE_WIDTH, 1, 0, _coordy);
+	m_colors.update(colors, ZCONSOLE_WIDTH, 1, 0, _coordy);
+	m_cachevalid = false;
+}
+
+
+sf::Vector2f Zconsole::Zrenderer::getCellPosition(
+	unsigned int _coordx, 
+	unsigned int _coordy) const {
+
+	return sf::Vector2f(
+		m_cellsize.x * _coordx, 
+		m_cellsize.y * _coordy + m_lpconsole->m_charsize);
+}
+
+
+void Zconsole::Zrenderer::uploadVertexBuffer() {
+	const auto& vertices = *m_lpconsole->m_vertices;
+
+	if (m_buffer.getVertexCount() != vertices.size()) {
+		m_buffer.setPrimitiveType(sf::Triangles);
+		m_buffer.setUsage(sf::VertexBuffer::Dynamic);
+		if (!m_buffer.create(vertices.size())) {
+			m_mode = ZRENDER_VERTEXARRAY;
+			return;
+		}
+		invalidate();
+	}
+	//only the range touched since the last frame goes over the bus
+	m_dirtylast = std::min<unsigned int>(m_dirtylast, vertices.size());
+	if (m_dirtyfirst < m_dirtylast) {
+		m_buffer.update(
+			vertices.data() + m_dirtyfirst, 
+			m_dirtylast - m_dirtyfirst, 
+			m_dirtyfirst);
+	}
+	m_dirtyfirst = m_dirtylast = 0;
+}
+
+
+void Zconsole::Zrenderer::present(
+	sf::RenderTarget&       _rendertarget,
+	const sf::RenderStates& _renderstates) {
+
+	//nothing is laid out until the first update
+	if (m_lpconsole->m_layoutdirty) 
+		return;
+
+	if (m_caching && updateCache(_renderstates)) {
+		sf::RenderStates states(_renderstates);
+		states.texture = &m_cache.getTexture();
+		_rendertarget.draw(m_cachequad, 6, sf::Triangles, states);
+		return;
+	}
+	draw(_rendertarget, _renderstates);
+}
+
+
+void Zconsole::Zrenderer::setCaching(bool _enable) {
+	m_caching    = _enable;
+	m_cachevalid = false;
+}
+
+
+bool Zconsole::Zrenderer::isCaching() const {
+	return m_caching;
+}
+
+
+bool Zconsole::Zrenderer::isCacheValid() const {
+	return m_caching && m_cachevalid;
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
@@ -0,0 +1,136 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zrenderer.hpp
+* Desc: interface for console rendering backends
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZRENDERER_HPP__
+#define __ZRENDERER_HPP__
+
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::Zrenderer final : sf::NonCopyable {
+public: 
+	Zrenderer(Zconsole* const _lpconsole) :
+		m_lpconsole(_lpconsole) {}
+	~Zrenderer() {}	
+
+	/*
+	Initialize the renderer, the vertex array backend is selected*/
+	void initialize();
+
+	/*
+	Select the backend used to draw the console.
+	@_mode : the rendering backend
+	@return: false if the backend is unavailable and the
+	         vertex array backend was selected instead*/
+	bool setMode(zrendermode _mode);
+
+	/*
+	Returns the backend currently used to draw the console*/
+	zrendermode getMode() const;
+
+	/*
+	Flag a range of console vertices as modified, so that
+	backends holding a copy of them can refresh that range.
+	@_first: index of the first modified vertex
+	@_count: the number of modified vertices*/
+	void invalidate(unsigned int _first, unsigned int _count);
+
+	/*
+	Flag every console vertex as modified*/
+	void invalidate();
+
+	/*
+	Refresh one row of the cell grid data textures from the 
+	screen cell matrix, only used by the cell grid backend.
+	@_coordy: the row to refresh*/
+	void updateCells(unsigned int _coordy);
+
+	/*
+	Returns the pen position of a cell in the cell grid.
+	@_coordx: column of the cell
+	@_coordy: row of the cell*/
+	sf::Vector2f getCellPosition(
+		unsigned int _coordx, 
+		unsigned int _coordy) const;
+
+	/*
+	Draw the console vertices with the selected backend
+	@_rendertarget: where to draw
+	@_renderstates: states (texture, transform) to draw with*/
+	void present(
+		sf::RenderTarget&       _rendertarget, 
+		const sf::RenderStates& _renderstates);
+
+	/*
+	Enable or disable drawing through a cached image: the console is
+	rendered into a texture only when it changed, and every frame 
+	draws that texture as a single quad.
+	@_enable: true to enable caching, false to disable it*/
+	void setCaching(bool _enable);
+
+	/*
+	Returns true if caching is enabled*/
+	bool isCaching() const;
+
+	/*
+	Returns true if caching is enabled and the cached image 
+	still matches the contents of the console*/
+	bool isCacheValid() const;
+
+private:
+	bool buildCellGrid();
+	void uploadVertexBuffer();
+	void presentCellGrid(
+		sf::RenderTarget&       _rendertarget, 
+		const sf::RenderStates& _renderstates);
+	void draw(
+		sf::RenderTarget&       _rendertarget, 
+		const sf::RenderStates& _renderstates);
+	sf::FloatRect getBounds() const;
+	bool updateCache(const sf::RenderStates& _renderstates);
+
+	zrendermode            m_mode;         //selected backend
+	sf::VertexBuffer       m_buffer;       //gpu copy of the console vertices
+	unsigned int           m_dirtyfirst;   //first vertex not yet uploaded
+	unsigned int           m_dirtylast;    //one past the last vertex not uploaded
+	sf::Shader             m_shader;       //cell grid fragment shader
+	sf::Texture            m_atlas;        //one glyph per cell sized slot
+	sf::Texture            m_cells;        //atlas slot of every cell
+	sf::Texture            m_colors;       //color of every cell
+	sf::Vertex             m_gridquad[6];  //the quad covering the cell grid
+	sf::Vector2f           m_cellsize;     //size of one cell
+	float                  m_baseline;     //baseline offset within a cell
+	std::vector<sf::Uint8> m_cellpixels;   //staging data for m_cells
+	std::vector<sf::Uint8> m_colorpixels;  //staging data for m_colors
+	sf::RenderTexture      m_cache;        //cached image of the console
+	sf::Vertex             m_cachequad[6]; //the quad drawing the cached image
+	bool                   m_caching;      //draw through the cached image
+	bool                   m_cachevalid;   //cached image is up to date
+	Zconsole* const        m_lpconsole;
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -0,0 +1,125 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zringbuffer.hpp
+* Desc: fixed capacity ring buffer for console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZRINGBUFFER_HPP__
+#define __ZRINGBUFFER_HPP__
+
+#include "zconsole/zconsole.hpp"
+
+
+
+template <typename T>
+class Zconsole::ZringBuffer final  {
+public: 
+	ZringBuffer(unsigned int _capacity) :
+		m_items(_capacity),
+		m_head(0),
+		m_count(0) {}
+	~ZringBuffer() {}	
+
+	/*
+	Append an item after the newest one. When the buffer is full 
+	the oldest item is overwritten, nothing is ever shifted.
+	@_item: the item to append*/
+	void push_back(T&& _item) {
+		m_items[slot(m_count)] = std::move(_item);
+		if (m_count < capacity())
+			++m_count;
+		else
+			m_head = slot(1);
+	}
+	void push_back(const T& _item) {
+		push_back(T(_item));
+	}
+
+	/*
+	Remove the oldest item, the buffer must not be empty*/
+	void pop_front() {
+		m_items[m_head] = T();
+		m_head = slot(1);
+		--m_count;
+	}
+
+	/*
+	Remove every item, capacity is kept*/
+	void clear() {
+		while (m_count != 0)
+			pop_front();
+		m_head = 0;
+	}
+
+	/*
+	Returns the item at a position counted from the oldest item.
+	@_index: position of the item, must be less than size()*/
+	inline T& operator[](unsigned int _index) { 
+		return m_items[slot(_index)]; 
+	}
+	inline const T& operator[](unsigned int _index) const { 
+		return m_items[slot(_index)]; 
+	}
+
+	/*
+	Returns the oldest item, the buffer must not be empty*/
+	inline T& front() { 
+		return m_items[m_head]; 
+	}
+
+	/*
+	Returns the number of items in the buffer*/
+	inline unsigned int size() const { 
+		return m_count; 
+	}
+
+	/*
+	Returns the number of items the buffer can hold*/
+	inline unsigned int capacity() const { 
+		return (unsigned int)m_items.size(); 
+	}
+
+	/*
+	Returns true if the buffer holds no items*/
+	inline bool empty() const { 
+		return m_count == 0; 
+	}
+
+	/*
+	Returns true if the next push_back overwrites the oldest item*/
+	inline bool full() const { 
+		return m_count == capacity(); 
+	}
+
+private:
+	inline unsigned int slot(unsigned int _index) const {
+		const unsigned int index = m_head + _index;
+		return index < capacity() ? index : index - capacity();
+	}
+
+	std::vector<T> m_items; //fixed storage, allocated once
+	unsigned int   m_head;  //slot of the oldest item
+	unsigned int   m_count; //number of items in use
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
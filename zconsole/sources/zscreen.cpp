@@ -1,313 +1,515 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: zscreen.cpp
-* Desc: interface for console screen
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/  
-#include "zconsoledefs.hpp"
-#include "zscreen.hpp"
-
-
-
-/* Section 1:
-** internal data
-******************************************************************************/
-#define CELLMATRIX_FRAME_UL   0x00002554 //ascii char- upper left corner 
-#define CELLMATRIX_FRAME_UR   0x00002557 //ascii char- upper right corner
-#define CELLMATRIX_FRAME_BL   0x0000255A //ascii char- bottom left corner
-#define CELLMATRIX_FRAME_BR   0x0000255D //ascii char- bottom right corner
-#define CELLMATRIX_FRAME_RGBA 0xFFFFFFFF //frame character color code
-#define CELLMATRIX_FRAME_HBAR 0x00002550 //ascii char- horizontal bar
-#define CELLMATRIX_FRAME_VBAR 0x00002551 //ascii char- vertical bar
-
-const Zconsole::Zscreen::LineEntry
-Zconsole::Zscreen::emptyline;
-
-
-
-
-
-/* Section 2:
-** internal interface functions
-******************************************************************************/
-void Zconsole::Zscreen::initLineEntry(
-	LineEntry*      _line, 
-	const zstring&  _string, 
-	const zustring& _colors) {
-
-	_line->text = _string;
-	_line->rgba = _colors;
-
-	if (_line->text.empty()) {
-		_line->text = " "; 
-	} 
-	_line->rgba.resize(
-		_line->text.size(), 
-		m_lpconsole->m_textcolor); 
-}
-
-
-const zustring& 
-Zconsole::Zscreen::getWideColor(int _index) {
-	if (_index < 0) 
-		_index = m_widemessage.size() + _index;
-	_index += m_firstmsg;
-	if (_index < 0 || (unsigned int)_index >= m_widemessage.size())
-		return emptyline.rgba;
-	return m_widemessage[_index].rgba;
-} 
-
-
-const zstring& 
-Zconsole::Zscreen::getWideMessage(int _index) {
-	if (_index < 0) 
-		_index = m_widemessage.size() + _index;
-	_index += m_firstmsg;
-	if (_index < 0 || (unsigned int)_index >= m_widemessage.size())
-		return emptyline.text;
-	return m_widemessage[_index].text;
-}  
-
-
-unsigned int
-Zconsole::Zscreen::pushWideMessages(
-	const LineEntry& _textline,
-	LineBatch*       _widemsgs,
-	unsigned int     _width) {
-
-	unsigned int ret       = 0u;
-	unsigned int start     = 0u;
-	unsigned int charcount = 0u;	
-
-	//push pieces of str if they go over width or if we encounter a newline
-	for (unsigned int i = 0u; i < _textline.text.size(); ++i) {
-		++charcount;
-		if (_textline.text[i] == '\n' || charcount >= _width) {
-			if (_textline.text[i] == '\n') --charcount;
-			if (_widemsgs) {
-				LineEntry line;
-				line.text = _textline.text.substr(start, charcount);
-				line.rgba = _textline.rgba.substr(start, charcount);
-				_widemsgs->push_back(line);
-			}
-			++ret;
-			start = i + 1u;
-			charcount = 0u;
-		}
-	} 
-	//push last piece if loop didn't
-	if (charcount != 0u) {
-		if (_widemsgs) {
-			LineEntry line;
-			line.text  = _textline.text.substr(start, charcount);
-			line.rgba = _textline.rgba.substr(start, charcount);
-			_widemsgs->push_back(line);
-		}
-		++ret;
-	}
-	return ret;
-}  
-
-
-void 
-Zconsole::Zscreen::processLineEcho(
-	const zstring&  _string, 
-	const zustring& _colors) {
-
-	unsigned int msgOffset;
-
-	LineEntry line;
-	initLineEntry(&line, _string, _colors);
-
-	m_message.push_back(line);
-	pushWideMessages(
-		line, 
-		&m_widemessage, 
-		ZCONSOLE_WIDTH - 2);
-
-	if (m_message.size() > ZCONSOLE_MAXMSGSAVE) {
-		msgOffset = 
-			pushWideMessages(
-			*m_message.begin(), 0x0, ZCONSOLE_WIDTH - 2);
-
-		m_message.erase(m_message.begin());
-		m_widemessage.erase(
-			m_widemessage.begin(), 
-			m_widemessage.begin() + msgOffset);
-	}
-	scroll(ZCONSOLE_SCROLLEND); //make this conditional?
-	++m_lpconsole->m_pendingUpdates;
-}  
-
-
-Zconsole::Zscreen::Cell*
-Zconsole::Zscreen::getCellsAt(unsigned int _coordx, unsigned int _coordy) {
-	unsigned int index;
-	if (_coordx + 1 < ZCONSOLE_WIDTH &&
-		_coordy + 1 < ZCONSOLE_HEIGHT) {
-
-		index = _coordx + ZCONSOLE_WIDTH * _coordy;
-		return &m_matrix[index];
-	}
-	return nullptr; 
-} 
-
-
-
-
-
-/* Section 3:
-** public interface functions
-******************************************************************************/
-void Zconsole::Zscreen::clear() {
-	m_firstmsg = 0;
-	m_message.clear();
-	m_widemessage.clear(); 
-}  
-
-
-void Zconsole::Zscreen::echoLine(const zstring& _string) {
-	LineEntry line;
-	line.text = _string;
-	line.rgba.resize(line.text.size(), m_lpconsole->m_textcolor);
-	processLineEcho(line.text, line.rgba);
-} 
-
-
-Zconsole::Zscreen::Cell* const
-Zconsole::Zscreen::getCellMatrix() { 
-	update();
-	if (!m_matrix.empty())
-		return &m_matrix[0];
-	return nullptr;
-} 
-
-
-void Zconsole::Zscreen::scroll(int _linecount) {
-	int lastmsg;
-	lastmsg = (ZCONSOLE_HEIGHT - 3) - (int)m_widemessage.size();
-
-	m_firstmsg += _linecount;
-	//ensure we go no further than last or first line
-	m_firstmsg = std::max<int>(m_firstmsg, lastmsg);
-	m_firstmsg = std::min(m_firstmsg, 0);
-
-	++m_lpconsole->m_pendingUpdates;
-} 
-
-
-void Zconsole::Zscreen::update() { 
-	static unsigned int lastupdate = 0;
-	if (lastupdate == m_lpconsole->m_pendingUpdates)
-		return; 
-
-	lastupdate = m_lpconsole->m_pendingUpdates; 
-
-	for (unsigned int i = 1; i < (ZCONSOLE_HEIGHT - 2); ++i) {
-		const auto& wstr  = getWideMessage(i - (ZCONSOLE_HEIGHT - 2)); 
-		const auto& rgba  = getWideColor(i - (ZCONSOLE_HEIGHT - 2)); 
-		auto* const cells = getCellsAt(1u, i);
-
-		for (unsigned int x = 0; x < (ZCONSOLE_WIDTH - 2); ++x) {
-			cells[x].mchar = ' ';
-			cells[x].color = CELLMATRIX_FRAME_RGBA; 
-		}
-		for (unsigned int x = 0u; x < wstr.size(); ++x) {
-			cells[x].mchar = wstr[x];
-			cells[x].color = rgba[x];
-		}
-	}
-	auto* const cells = getCellsAt(1, ZCONSOLE_HEIGHT - 2);
-
-	for (unsigned int x = 0; x < (ZCONSOLE_WIDTH - 2); ++x) {
-		cells[x].mchar = ' ';
-		cells[x].color = m_lpconsole->m_textcolor;
-	}
-	for (unsigned int x = 0; x < (ZCONSOLE_WIDTH - 2) &&
-		 (m_lpconsole->m_lastlineOffset + x) < 
-		m_lpconsole->m_lastline.size(); ++x) {
-		cells[x].mchar =
-			m_lpconsole->m_lastline[m_lpconsole->m_lastlineOffset + x];
-	}
-} 
-
-
-void Zconsole::Zscreen::initialize() {   
-	m_lpconsole->m_pendingUpdates  = 1; 
-    m_lpconsole->m_lastlineOffset  = 0;  
-	m_lpconsole->m_textcolor       = ZCONSOLE_TEXTCOLOR;  
-
-	m_firstmsg = 0;
-	m_widemessage.clear();
-
-	for (unsigned int index = 0; index < m_message.size(); ++index) {
-		pushWideMessages(
-			m_message[index], &m_widemessage, ZCONSOLE_WIDTH - 2);
-	}
-	++m_lpconsole->m_pendingUpdates;
-
-	/*
-	Initialize the screen matrix with empty cells:*/
-	m_matrix.assign(ZCONSOLE_TOTALSIZE, Cell());
-	 
-	/*
-	Define top and bottom sides:
-	---------------------------*/
-	for (unsigned int index = 0; index < ZCONSOLE_WIDTH; ++index) {
-
-		unsigned int top = (index + ZCONSOLE_WIDTH * 0);
-		unsigned int bot = (index + ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 1));
-		 
-		m_matrix[top].mchar = CELLMATRIX_FRAME_HBAR;
-		m_matrix[bot].mchar = CELLMATRIX_FRAME_HBAR;
-		m_matrix[top].color = CELLMATRIX_FRAME_RGBA;
-		m_matrix[bot].color = CELLMATRIX_FRAME_RGBA;
-	}
-	/*
-	Define left and right sides:
-	---------------------------*/
-	for (unsigned int index = 0; index < ZCONSOLE_HEIGHT; ++index) {
-
-		unsigned int lft = (0 + ZCONSOLE_WIDTH * index);
-		unsigned int rgt = (ZCONSOLE_WIDTH - 1 + ZCONSOLE_WIDTH * index);
-		 
-		m_matrix[lft].mchar = CELLMATRIX_FRAME_VBAR;
-		m_matrix[rgt].mchar = CELLMATRIX_FRAME_VBAR;
-		m_matrix[lft].color = CELLMATRIX_FRAME_RGBA;
-		m_matrix[rgt].color = CELLMATRIX_FRAME_RGBA;
-	}
-	/*
-	Define corners:
-	---------------------------*/
-	unsigned int ul = 0 + ZCONSOLE_WIDTH * 0;
-	unsigned int bl = 0 + ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 1);
-	unsigned int br = ZCONSOLE_WIDTH - 1 + ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 1);
-	unsigned int ur = ZCONSOLE_WIDTH - 1 + ZCONSOLE_WIDTH * 0;
-	 
-	m_matrix[ul].mchar = CELLMATRIX_FRAME_UL; //upper left
-	m_matrix[bl].mchar = CELLMATRIX_FRAME_BL; //bottom left
-	m_matrix[br].mchar = CELLMATRIX_FRAME_BR; //bottom right
-	m_matrix[ur].mchar = CELLMATRIX_FRAME_UR; //upper right
-} 
-/*****************************************************************************/  
-//EOF
-/*****************************************************************************/  
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zscreen.cpp
+* Desc: interface for console screen
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/  
+#include <cstring>
+#include "zconsoledefs.hpp"
+#include "zhelperfuncs.hpp"
+#include "zprintqueue.hpp"
+#include "zthreadlog.hpp"
+#include "zscreen.hpp"
+
+
+
+/* Section 1:
+** internal data
+******************************************************************************/
+#define CELLMATRIX_FRAME_UL   0x00002554 //ascii char- upper left corner 
+#define CELLMATRIX_FRAME_UR   0x00002557 //ascii char- upper right corner
+#define CELLMATRIX_FRAME_BL   0x0000255A //ascii char- bottom left corner
+#define CELLMATRIX_FRAME_BR   0x0000255D //ascii char- bottom right corner
+#define CELLMATRIX_FRAME_RGBA 0xFFFFFFFF //frame character color code
+#define CELLMATRIX_FRAME_HBAR 0x00002550 //ascii char- horizontal bar
+#define CELLMATRIX_FRAME_VBAR 0x00002551 //ascii char- vertical bar
+#define CELLMATRIX_MATCH_RGBA 0xFFB000FF //search match color code
+#define CELLMATRIX_FOCUS_RGBA 0x00FFFFFF //current search match color code
+
+
+
+
+
+/* Section 2:
+** internal interface functions
+******************************************************************************/
+Zconsole::Zscreen::WideRow
+Zconsole::Zscreen::getWideRow(int _index, unsigned int& _row) {
+	const WideRow emptyrow = { nullptr, 0, 0, nullptr, 0, 0 };
+	const int     count    = (int)getViewRowCount();
+
+	_row = 0;
+	if (_index < 0) 
+		_index = count + _index;
+	_index += m_firstmsg;
+	if (_index < 0 || _index >= count)
+		return emptyrow;
+
+	//the filter view maps its rows onto scrollback rows
+	_row = m_filter.isActive() ? 
+		m_filter.getRow((unsigned int)_index) : 
+		m_message.getRowBase() + (unsigned int)_index;
+	return m_message.getRow(_row - m_message.getRowBase());
+} 
+
+
+unsigned int Zconsole::Zscreen::getViewRowCount() const {
+	if (m_filter.isActive())
+		return m_filter.getRowCount();
+	return m_message.getRowCount();
+} 
+
+
+void 
+Zconsole::Zscreen::processLineEcho(
+	const char*     _text, 
+	unsigned int    _size,
+	const zustring& _colors) {
+
+	//only the break offsets are kept, rows are cut out when displayed
+	if (_size == 0) {
+		_text = " ";
+		_size = 1;
+	}
+	m_message.push(
+		_text, 
+		_size,
+		_colors, 
+		m_lpconsole->m_textcolor,
+		ZCONSOLE_WIDTH - 2);
+}  
+
+
+Zconsole::Zscreen::Cell*
+Zconsole::Zscreen::getCellsAt(unsigned int _coordx, unsigned int _coordy) {
+	unsigned int index;
+	if (_coordx + 1 < ZCONSOLE_WIDTH &&
+		_coordy + 1 < ZCONSOLE_HEIGHT) {
+
+		index = _coordx + ZCONSOLE_WIDTH * _coordy;
+		return &m_matrix[index];
+	}
+	return nullptr; 
+} 
+
+
+void Zconsole::Zscreen::highlightRow(
+	unsigned int   _row,
+	const WideRow& _wide, 
+	Cell*          _cells) {
+
+	if (m_findtext.empty() || !_wide.text)
+		return;
+
+	const char*        pattern = m_findtext.c_str();
+	const unsigned int length  = (unsigned int)m_findtext.size();
+	const char*        line    = _wide.text - _wide.offset;
+
+	//matches may start in an earlier row or end in a later one
+	unsigned int from = 
+		_wide.offset >= length - 1 ? _wide.offset - (length - 1) : 0;
+	const unsigned int end = 
+		std::min(_wide.length, _wide.offset + _wide.size + length - 1);
+
+	unsigned int at;
+	while (from < end && Zconsole_FindSubstring(
+		line + from, end - from, pattern, length, at)) {
+
+		const unsigned int start = from + at;
+		const unsigned int first = std::max(start, _wide.offset);
+		const unsigned int last  = 
+			std::min(start + length, _wide.offset + _wide.size);
+
+		const bool focus = 
+			start == m_findmatch.offset &&
+			_row - m_findmatch.row <= m_findmatch.last - m_findmatch.row;
+
+		for (unsigned int x = first; x < last; ++x) {
+			_cells[x - _wide.offset].color = 
+				focus ? CELLMATRIX_FOCUS_RGBA : CELLMATRIX_MATCH_RGBA;
+		}
+		from = start + 1;
+	}
+}
+
+
+void Zconsole::Zscreen::commitRow(
+	unsigned int _coordy, 
+	const Cell*  _cells) {
+
+	auto* const cells = getCellsAt(1u, _coordy);
+	const auto  bytes = sizeof(Cell) * (ZCONSOLE_WIDTH - 2);
+
+	//only flag the row when its contents actually changed
+	if (memcmp(cells, _cells, bytes) != 0) {
+		memcpy(cells, _cells, bytes);
+		m_dirtyrows[_coordy] = true;
+	}
+}
+
+
+
+
+
+/* Section 3:
+** public interface functions
+******************************************************************************/
+void Zconsole::Zscreen::clear() {
+	m_firstmsg = 0;
+	m_message.clear();
+	clearFind();
+
+	//row numbers start over, so does the filter
+	if (m_filter.isActive()) {
+		const zstring pattern = m_filter.getPattern();
+		m_filter.start(pattern, m_message);
+	}
+}  
+
+
+void Zconsole::Zscreen::echoLine(zstrview _string) {
+	//the whole line uses the text color
+	processLineEcho(_string.data(), (unsigned int)_string.size(), zustring());
+
+	scroll(ZCONSOLE_SCROLLEND); //make this conditional?
+	++m_lpconsole->m_pendingUpdates;
+} 
+
+
+void Zconsole::Zscreen::echoLog(
+	unsigned int         _site, 
+	const unsigned char* _args, 
+	unsigned int         _size) {
+
+	m_message.pushLog(
+		_site, 
+		_args, 
+		_size, 
+		m_lpconsole->m_textcolor, 
+		ZCONSOLE_WIDTH - 2);
+	scroll(ZCONSOLE_SCROLLEND);
+}
+
+
+void Zconsole::Zscreen::echoQueue(ZprintQueue& _queue) {
+	const zustring colors;
+
+	const unsigned int count = _queue.drain(
+		[&](const char* _text, unsigned int _size) {
+			processLineEcho(_text, _size, colors);
+		});
+
+	const unsigned int dropped = _queue.takeDropped();
+	if (dropped != 0) {
+		zformat line;
+		Zconsole_FormatLine(line, "{} queued lines were dropped", dropped);
+		processLineEcho(line.text, (unsigned int)line.size, colors);
+	}
+	if (count != 0 || dropped != 0)
+		scroll(ZCONSOLE_SCROLLEND);
+}
+
+
+void Zconsole::Zscreen::echoThreads(ZthreadLog& _threadlog) {
+	const zustring colors;
+
+	const unsigned int count = _threadlog.collect(
+		[&](unsigned int _id, const char* _text, unsigned int _size) {
+			zformat line;
+			Zconsole_FormatLine(line, "[T{}] {}", _id, zstrview(_text, _size));
+			processLineEcho(line.text, (unsigned int)line.size, colors);
+		});
+
+	const unsigned int dropped = _threadlog.takeDropped();
+	if (dropped != 0) {
+		zformat line;
+		Zconsole_FormatLine(line, "{} thread lines were dropped", dropped);
+		processLineEcho(line.text, (unsigned int)line.size, colors);
+	}
+	if (count != 0 || dropped != 0)
+		scroll(ZCONSOLE_SCROLLEND);
+}
+
+
+void Zconsole::Zscreen::echoLines(const zstring* _lines, unsigned int _count) {
+	if (_count == 0)
+		return;
+
+	const zustring colors;
+	for (unsigned int i = 0; i < _count; ++i) {
+		processLineEcho(
+			_lines[i].data(), (unsigned int)_lines[i].size(), colors);
+	}
+	//scrolling invalidates the screen once for the whole batch
+	scroll(ZCONSOLE_SCROLLEND);
+}
+
+
+void Zconsole::Zscreen::echoBlock(zstrview _block) {
+	const zustring colors;
+
+	//a trailing newline does not open an empty last line
+	std::size_t first = 0;
+	do {
+		std::size_t last = _block.find('\n', first);
+		if (last == zstrview::npos)
+			last = _block.size();
+
+		//windows line endings leave a carriage return behind
+		std::size_t end = last;
+		if (end > first && _block[end - 1] == '\r')
+			--end;
+		processLineEcho(
+			_block.data() + first, (unsigned int)(end - first), colors);
+		first = last + 1;
+	} while (first < _block.size());
+
+	//scrolling invalidates the screen once for the whole batch
+	scroll(ZCONSOLE_SCROLLEND);
+}
+
+
+Zconsole::Zscreen::Cell* const
+Zconsole::Zscreen::getCellMatrix() { 
+	update();
+	if (!m_matrix.empty())
+		return &m_matrix[0];
+	return nullptr;
+} 
+
+
+void Zconsole::Zscreen::scroll(int _linecount) {
+	int lastmsg;
+	lastmsg = (ZCONSOLE_HEIGHT - 3) - (int)getViewRowCount();
+
+	m_firstmsg += _linecount;
+	//ensure we go no further than last or first line
+	m_firstmsg = std::max<int>(m_firstmsg, lastmsg);
+	m_firstmsg = std::min(m_firstmsg, 0);
+
+	++m_lpconsole->m_pendingUpdates;
+} 
+
+
+void Zconsole::Zscreen::update() { 
+	static unsigned int lastupdate = 0;
+
+	//bring a search match into view, once the command output is printed
+	if (m_findscroll) {
+		unsigned int row = m_findmatch.row - m_message.getRowBase();
+		m_findscroll = false;
+
+		//a match outside the filter view is not scrolled to
+		if (!m_filter.isActive() || 
+			m_filter.getViewRow(m_findmatch.row, row)) {
+			const int top = 
+				(int)row - (int)getViewRowCount() + (ZCONSOLE_HEIGHT - 2) / 2;
+			scroll(top - m_firstmsg);
+		}
+	}
+	if (lastupdate == m_lpconsole->m_pendingUpdates)
+		return; 
+
+	lastupdate = m_lpconsole->m_pendingUpdates; 
+
+	Cell row[ZCONSOLE_WIDTH - 2];
+
+	for (unsigned int i = 1; i < (ZCONSOLE_HEIGHT - 2); ++i) {
+		unsigned int line;
+		const auto   wide = getWideRow(i - (ZCONSOLE_HEIGHT - 2), line); 
+
+		for (unsigned int x = 0; x < (ZCONSOLE_WIDTH - 2); ++x) {
+			row[x].mchar = ' ';
+			row[x].color = CELLMATRIX_FRAME_RGBA; 
+		}
+		for (unsigned int x = 0u; x < wide.size; ++x) {
+			row[x].mchar = wide.text[x];
+		}
+		//expand the color runs that overlap this row into its cells
+		for (unsigned int r = 0u; r < wide.runcount; ++r) {
+			const auto& run = wide.runs[r];
+			const unsigned int first = 
+				std::max(run.offset, wide.offset) - wide.offset;
+			const unsigned int last = 
+				std::min(run.offset + run.length, wide.offset + wide.size);
+
+			for (unsigned int x = first; x + wide.offset < last; ++x)
+				row[x].color = run.color;
+		}
+		highlightRow(line, wide, row);
+		commitRow(i, row);
+	}
+	for (unsigned int x = 0; x < (ZCONSOLE_WIDTH - 2); ++x) {
+		row[x].mchar = ' ';
+		row[x].color = m_lpconsole->m_textcolor;
+	}
+	for (unsigned int x = 0; x < (ZCONSOLE_WIDTH - 2) &&
+		 (m_lpconsole->m_lastlineOffset + x) < 
+		m_lpconsole->m_lastline.size(); ++x) {
+
+		row[x].mchar =
+			m_lpconsole->m_lastline[m_lpconsole->m_lastlineOffset + x];
+	}
+	commitRow(ZCONSOLE_HEIGHT - 2, row);
+} 
+
+
+bool Zconsole::Zscreen::isRowDirty(unsigned int _coordy) const {
+	return _coordy < m_dirtyrows.size() && m_dirtyrows[_coordy];
+}
+
+
+void Zconsole::Zscreen::clearDirtyRows() {
+	m_dirtyrows.assign(ZCONSOLE_HEIGHT, false);
+}
+
+
+void Zconsole::Zscreen::invalidate() {
+	m_dirtyrows.assign(ZCONSOLE_HEIGHT, true);
+}
+
+
+void Zconsole::Zscreen::initialize() {   
+	m_lpconsole->m_pendingUpdates  = 1; 
+    m_lpconsole->m_lastlineOffset  = 0;  
+	m_lpconsole->m_textcolor       = ZCONSOLE_TEXTCOLOR;  
+
+	m_firstmsg   = 0;
+	m_findscroll = false;
+	++m_lpconsole->m_pendingUpdates;
+
+	m_message.setLogTable(m_lpconsole->m_logtable.get());
+
+	/*
+	Initialize the screen matrix with empty cells:*/
+	m_matrix.assign(ZCONSOLE_TOTALSIZE, Cell());
+	invalidate();
+	 
+	/*
+	Define top and bottom sides:
+	---------------------------*/
+	for (unsigned int index = 0; index < ZCONSOLE_WIDTH; ++index) {
+
+		unsigned int top = (index + ZCONSOLE_WIDTH * 0);
+		unsigned int bot = (index + ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 1));
+		 
+		m_matrix[top].mchar = CELLMATRIX_FRAME_HBAR;
+		m_matrix[bot].mchar = CELLMATRIX_FRAME_HBAR;
+		m_matrix[top].color = CELLMATRIX_FRAME_RGBA;
+		m_matrix[bot].color = CELLMATRIX_FRAME_RGBA;
+	}
+	/*
+	Define left and right sides:
+	---------------------------*/
+	for (unsigned int index = 0; index < ZCONSOLE_HEIGHT; ++index) {
+
+		unsigned int lft = (0 + ZCONSOLE_WIDTH * index);
+		unsigned int rgt = (ZCONSOLE_WIDTH - 1 + ZCONSOLE_WIDTH * index);
+		 
+		m_matrix[lft].mchar = CELLMATRIX_FRAME_VBAR;
+		m_matrix[rgt].mchar = CELLMATRIX_FRAME_VBAR;
+		m_matrix[lft].color = CELLMATRIX_FRAME_RGBA;
+		m_matrix[rgt].color = CELLMATRIX_FRAME_RGBA;
+	}
+	/*
+	Define corners:
+	---------------------------*/
+	unsigned int ul = 0 + ZCONSOLE_WIDTH * 0;
+	unsigned int bl = 0 + ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 1);
+	unsigned int br = ZCONSOLE_WIDTH - 1 + ZCONSOLE_WIDTH * (ZCONSOLE_HEIGHT - 1);
+	unsigned int ur = ZCONSOLE_WIDTH - 1 + ZCONSOLE_WIDTH * 0;
+	 
+	m_matrix[ul].mchar = CELLMATRIX_FRAME_UL; //upper left
+	m_matrix[bl].mchar = CELLMATRIX_FRAME_BL; //bottom left
+	m_matrix[br].mchar = CELLMATRIX_FRAME_BR; //bottom right
+	m_matrix[ur].mchar = CELLMATRIX_FRAME_UR; //upper right
+} 
+
+
+bool Zconsole::Zscreen::find(const zstring& _text, bool _forward) {
+	if (!_text.empty()) {
+		m_findtext = Zconsole_StringToLower(_text);
+		m_findmatch.first  = 
+			m_message.getRowBase() + m_message.getRowCount() - 1;
+		m_findmatch.row    = m_findmatch.first;
+		m_findmatch.last   = m_findmatch.first;
+		m_findmatch.offset = 0;
+	}
+	if (m_findtext.empty() || 
+		!m_message.find(m_findtext, _forward, m_findmatch))
+		return false;
+
+	m_findscroll = true;
+	++m_lpconsole->m_pendingUpdates;
+	return true;
+}
+
+
+void Zconsole::Zscreen::clearFind() {
+	m_findtext.clear();
+	m_findscroll = false;
+	++m_lpconsole->m_pendingUpdates;
+}
+
+
+bool Zconsole::Zscreen::setSpill(const zstring& _filepath) {
+	const bool success = m_message.setSpill(_filepath);
+	scroll(0); //keep the view inside the new row count
+	return success;
+}
+
+
+void Zconsole::Zscreen::setMaxBytes(unsigned long long _bytes) {
+	m_message.setMaxBytes(_bytes);
+	scroll(0); //keep the view inside the new row count
+}
+
+
+bool Zconsole::Zscreen::setFilter(const zstring& _pattern) {
+	bool success = true;
+	if (_pattern.empty())
+		m_filter.stop();
+	else success = m_filter.start(_pattern, m_message);
+
+	scroll(ZCONSOLE_SCROLLEND);
+	return success;
+}
+
+
+void Zconsole::Zscreen::updateFilter() {
+	//keep the bottom of the view in place while results come in
+	if (m_filter.update(m_message))
+		scroll(0);
+}
+
+
+const Zconsole::Zfilter& Zconsole::Zscreen::getFilter() const {
+	return m_filter;
+}
+
+
+const Zconsole::Zscrollback& Zconsole::Zscreen::getScrollback() const {
+	return m_message;
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
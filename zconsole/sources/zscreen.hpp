@@ -1,115 +1,213 @@
-/******************************************************************************
-* zconsole - sfml based in-game console module 
-* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
-* 
-* File: zscreen.hpp
-* Desc: interface for console screen
-*******************************************************************************
-
-
-This software is provided 'as-is', without any express or implied
-warranty. In no event will the authors be held liable for any damages
-arising from the use of this software.
-
-Permission is granted to anyone to use this software for any purpose,
-including commercial applications, and to alter it and redistribute it
-freely, subject to the following restrictions:
-
-1. The origin of this software must not be misrepresented; you must not
-   claim that you wrote the original software. If you use this software
-   in a product, an acknowledgment in the product documentation would be
-   appreciated but is not required.
-2. Altered source versions must be plainly marked as such, and must not be
-   misrepresented as being the original software.
-3. This notice may not be removed or altered from any source distribution.
-******************************************************************************/ 
-#ifndef __ZSCREEN_HPP__
-#define __ZSCREEN_HPP__
-
-#include "zconsole/zconsole.hpp"  
-
-
-
-class Zconsole::Zscreen final  {
-public:
-	/*
-    A single cell in the screen matrix
-    representing a character and color*/
-    struct Cell {
-    	unsigned int mchar;
-    	unsigned int color;
-    };
-    /*
-    A line that was entered into the console*/
-    struct LineEntry {
-    	zstring  text;
-    	zustring rgba;
-    };
-    /*
-    a vector of LineEntry structures*/
-    typedef std::vector<LineEntry> LineBatch;
-	static const LineEntry emptyline;
-
-public: 
-	Zscreen(Zconsole* const _lpconsole) :
-		m_lpconsole(_lpconsole) {}
-	~Zscreen() {}	
-
-	/*
-	Initialize the console screen (cell matrix)*/
-	void initialize();
-
-	/*
-	Updates the cell matrix.
-	Must be called when updating the screen*/
-	void update();
-
-	/*
-	Clear the console screen*/
-	void clear();
-
-	/*
-	Print a string to the console screen
-	@_string: the string to print*/
-	void echoLine(const zstring& _string);
-
-	/*
-	Get a pointer to the screen cell matrix*/
-	Cell* const getCellMatrix();
-
-	/*
-	Scroll the screen by a given number of lines,
-	use this for ctrl + pageup/pagedown/up/down/home/end
-	@_linecount: the number of lines to scroll*/
-	void scroll(int _linecount);
-
-private:
-	void initLineEntry(
-		LineEntry*      _line,
-		const zstring&  _string,
-		const zustring& _colors);
-
-	unsigned int pushWideMessages(
-		const LineEntry& _textline,
-		LineBatch*       _widemsgs,
-		unsigned int     _width);
-
-	void processLineEcho(
-		const zstring&  _string, 
-		const zustring& _colors); 
-
-	Cell* getCellsAt(unsigned int _coordx, unsigned int _coordy); 
-
-	const zustring& getWideColor(int _index); 
-
-	const zstring& getWideMessage(int _index); 
-
-	int               m_firstmsg;
-	std::vector<Cell> m_matrix;
-	LineBatch         m_message;
-	LineBatch         m_widemessage;
-	Zconsole* const   m_lpconsole;
-};
-/*****************************************************************************/  
-#endif //EOF
-/*****************************************************************************/  
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zscreen.hpp
+* Desc: interface for console screen
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZSCREEN_HPP__
+#define __ZSCREEN_HPP__
+
+#include "zfilter.hpp"
+#include "zscrollback.hpp"
+#include "zconsole/zconsole.hpp"  
+
+
+
+class Zconsole::Zscreen final  {
+public:
+	/*
+    A single cell in the screen matrix
+    representing a character and color*/
+    struct Cell {
+    	unsigned int mchar;
+    	unsigned int color;
+    };
+    /*
+    One wrapped row of a line, pointing into the scrollback*/
+    typedef Zscrollback::Row WideRow;
+
+public: 
+	Zscreen(Zconsole* const _lpconsole) :
+		m_message(
+			ZCONSOLE_MAXMSGSAVE, 
+			ZCONSOLE_SCROLLBACKSIZE, 
+			ZCONSOLE_RETAINSIZE),
+		m_lpconsole(_lpconsole) {}
+	~Zscreen() {}	
+
+	/*
+	Initialize the console screen (cell matrix)*/
+	void initialize();
+
+	/*
+	Updates the cell matrix.
+	Must be called when updating the screen*/
+	void update();
+
+	/*
+	Clear the console screen*/
+	void clear();
+
+	/*
+	Print a string to the console screen
+	@_string: the string to print*/
+	void echoLine(zstrview _string);
+
+	/*
+	Print a deferred log line to the console screen, the line is
+	formatted when it is drawn.
+	@_site: the id of the log site
+	@_args: the raw bytes of the arguments
+	@_size: the number of argument bytes*/
+	void echoLog(
+		unsigned int         _site, 
+		const unsigned char* _args, 
+		unsigned int         _size);
+
+	/*
+	Print the lines queued by other threads as one batch, then the
+	number of lines the queue dropped since the last call if any.
+	@_queue: the queue to drain*/
+	void echoQueue(ZprintQueue& _queue);
+
+	/*
+	Print the lines logged by threads through their own buffers as one
+	batch, merged by time. Each line starts with the id of its thread
+	as [T<id>], which the thread command filters on.
+	@_threadlog: the buffers to collect*/
+	void echoThreads(ZthreadLog& _threadlog);
+
+	/*
+	Print several lines to the console screen, the screen scrolls
+	and is invalidated once for the whole batch.
+	@_lines: the first line to print
+	@_count: the number of lines to print*/
+	void echoLines(const zstring* _lines, unsigned int _count);
+
+	/*
+	Print a multiline text block to the console screen, the block is 
+	split at each newline without copying and printed as one batch.
+	@_block: the text to print*/
+	void echoBlock(zstrview _block);
+
+	/*
+	Get a pointer to the screen cell matrix*/
+	Cell* const getCellMatrix();
+
+	/*
+	Scroll the screen by a given number of lines,
+	use this for ctrl + pageup/pagedown/up/down/home/end
+	@_linecount: the number of lines to scroll*/
+	void scroll(int _linecount);
+
+	/*
+	Returns true if a row of the cell matrix changed since
+	the last call to clearDirtyRows().
+	@_coordy: the row to query*/
+	bool isRowDirty(unsigned int _coordy) const;
+
+	/*
+	Mark every row of the cell matrix as clean.
+	Call this once the changed rows were consumed*/
+	void clearDirtyRows();
+
+	/*
+	Mark every row of the cell matrix as changed*/
+	void invalidate();
+
+	/*
+	Enable or disable spilling old lines to a file
+	@_filepath: path of the spill file, empty to disable
+	@return   : true on success, else false*/
+	bool setSpill(const zstring& _filepath);
+
+	/*
+	Search the scrollback for a text, the match is scrolled into 
+	view and every visible occurrence of the text is highlighted.
+	A new search starts above the newest line (the command itself).
+	@_text   : the text to look for, empty to repeat the last search
+	@_forward: true to search toward newer lines, false toward older
+	@return  : true if a match was found*/
+	bool find(const zstring& _text, bool _forward);
+
+	/*
+	Stop highlighting the last search*/
+	void clearFind();
+
+	/*
+	Show only the lines matching a regular expression, matching 
+	runs on a worker thread and the view fills up as it goes. Only 
+	the first ZCONSOLE_FILTERCHARS characters of a line are matched.
+	@_pattern: the expression, empty to show every line again
+	@return  : true on success, false if the expression is invalid*/
+	bool setFilter(const zstring& _pattern);
+
+	/*
+	Collect filter results and hand out the next lines to match,
+	must be called once per frame*/
+	void updateFilter();
+
+	/*
+	Returns the filter of the screen*/
+	const Zfilter& getFilter() const;
+
+	/*
+	Set the retention budget of the scrollback
+	@_bytes: how many bytes of memory lines may take*/
+	void setMaxBytes(unsigned long long _bytes);
+
+	/*
+	Returns the scrollback holding the screen lines*/
+	const Zscrollback& getScrollback() const;
+
+private:
+	void processLineEcho(
+		const char*     _text, 
+		unsigned int    _size,
+		const zustring& _colors); 
+
+	Cell* getCellsAt(unsigned int _coordx, unsigned int _coordy); 
+
+	void commitRow(unsigned int _coordy, const Cell* _cells);
+
+	WideRow getWideRow(int _index, unsigned int& _row); 
+
+	unsigned int getViewRowCount() const;
+
+	void highlightRow(
+		unsigned int   _row, 
+		const WideRow& _wide, 
+		Cell*          _cells);
+
+	std::vector<bool>   m_dirtyrows;
+	Zfilter             m_filter;     //filtered view of the scrollback
+	Zscrollback::Match  m_findmatch;  //last search match
+	bool                m_findscroll; //the match still has to be scrolled to
+	zstring             m_findtext;   //last searched text, lowercase
+	int                 m_firstmsg;
+	std::vector<Cell>   m_matrix;
+	Zscrollback         m_message;
+	Zconsole* const     m_lpconsole;
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
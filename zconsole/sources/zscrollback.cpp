@@ -0,0 +1,626 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zscrollback.cpp
+* Desc: arena backed storage for console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#include <algorithm>
+#include "zconsoledefs.hpp"
+#include "zhelperfuncs.hpp"
+#include "zlogtable.hpp"
+#include "zscrollback.hpp"
+
+
+
+/* Section 1:
+** internal interface functions
+******************************************************************************/
+unsigned int Zconsole::Zscrollback::allocate(unsigned int _bytes) {
+	/*
+	Records are contiguous, a record that does not fit before the end
+	of the arena starts over at offset 0 and the tail end is skipped.
+	Trimming always happens in whole lines at the head:*/
+	for (;;) {
+		if (m_lines.empty()) {
+			m_head = m_tail = 0;
+		}
+		if (m_lines.empty() || m_tail > m_head) {
+			if (m_capacity - m_tail >= _bytes)
+				return m_tail;
+			if (m_head > _bytes) {
+				m_tail = 0;
+				return m_tail;
+			}
+		}
+		else if (m_head - m_tail > _bytes) {
+			return m_tail;
+		}
+		popLine();
+	}
+}
+
+
+Zconsole::Zscrollback::Parts
+Zconsole::Zscrollback::resolve(
+	const Record* _record, 
+	unsigned int  _first) {
+
+	Parts parts;
+	if (_record->runs != ZCONSOLE_LOGRECORD) {
+		parts.runs       = reinterpret_cast<const ColorRun*>(_record + 1);
+		parts.runcount   = _record->runs;
+		parts.breaks     = reinterpret_cast<const unsigned int*>(parts.runs + parts.runcount);
+		parts.breakcount = _record->breaks;
+		parts.text       = reinterpret_cast<const char*>(parts.breaks + parts.breakcount);
+		parts.size       = _record->size;
+		return parts;
+	}
+
+	/*
+	Log lines are formatted when first read, rows are mostly read in
+	order so consecutive lines never share a cache entry:*/
+	LogText& entry = m_logcache[_first % ZCONSOLE_LOGCACHE];
+	if (!entry.valid || entry.first != _first) {
+		const LogRecord* header = 
+			reinterpret_cast<const LogRecord*>(_record + 1);
+		const unsigned char* args = 
+			reinterpret_cast<const unsigned char*>(header + 1);
+
+		if (m_logtable)
+			m_logtable->format(header->site, args, entry.line);
+		else entry.line.size = 0;
+		if (entry.line.size > header->width)
+			entry.line.size = header->width;
+
+		entry.first      = _first;
+		entry.valid      = true;
+		entry.run.offset = 0;
+		entry.run.length = (unsigned int)entry.line.size;
+		entry.run.color  = header->color;
+	}
+	parts.runs       = &entry.run;
+	parts.runcount   = 1;
+	parts.breaks     = nullptr;
+	parts.breakcount = 0;
+	parts.text       = entry.line.text;
+	parts.size       = (unsigned int)entry.line.size;
+	return parts;
+}
+
+
+Zconsole::Zscrollback::Row
+Zconsole::Zscrollback::cutRow(
+	const Parts& _parts, 
+	unsigned int _wrap) {
+
+	/*
+	Cut the row out of the line using its break offsets:*/
+	const unsigned int start = 
+		_wrap == 0 ? 0 : _parts.breaks[_wrap - 1];
+	const unsigned int end   = 
+		_wrap < _parts.breakcount ? _parts.breaks[_wrap] : _parts.size;
+
+	Row row;
+	row.text     = _parts.text + start;
+	row.size     = end - start;
+	row.offset   = start;
+	row.runs     = _parts.runs;
+	row.runcount = _parts.runcount;
+	row.length   = _parts.size;
+	if (row.size != 0 && row.text[row.size - 1] == '\n')
+		--row.size;
+	return row;
+}
+
+
+const Zconsole::Zscrollback::Record* 
+Zconsole::Zscrollback::findRecord(
+	unsigned int  _row, 
+	unsigned int& _first) {
+
+	//spilled rows come first, then cold rows, then the arena
+	const unsigned int index   = _row - m_spillbase;
+	const unsigned int spilled = m_coldbase - m_spillbase;
+	const unsigned int older   = m_rowbase  - m_spillbase;
+	if (index < older) {
+		const unsigned char* record = index < spilled ?
+			m_spill.find(_row, _first) :
+			m_cold.find(_row, _first);
+		return reinterpret_cast<const Record*>(record);
+	}
+	if (index - older >= m_rowcount)
+		return nullptr;
+
+	/*
+	Rows are mostly looked up in order (drawing, searching), try the
+	lines next to the last one found before a binary search. Row 
+	numbers only ever grow so the index is sorted by them:*/
+	const unsigned int row   = _row - m_rowbase;
+	const unsigned int count = m_lines.size();
+
+	unsigned int lo = 0;
+	unsigned int hi = count;
+	for (unsigned int i = 0; i < 3; ++i) {
+		const unsigned int hint = m_lasthit + i - 1;
+		if (hint < count && 
+			m_lines[hint].first - m_rowbase <= row &&
+			(hint + 1 == count || m_lines[hint + 1].first - m_rowbase > row)) {
+			lo = hi = hint;
+			break;
+		}
+	}
+	while (hi - lo > 1) {
+		const unsigned int mid = lo + (hi - lo) / 2;
+		if (m_lines[mid].first - m_rowbase <= row)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	m_lasthit = lo;
+
+	const LineRef& line = m_lines[lo];
+	_first = line.first;
+	return reinterpret_cast<const Record*>(&m_arena[line.offset]);
+}
+
+
+void Zconsole::Zscrollback::popLine(bool _keep) {
+	const LineRef& line = m_lines.front();
+
+	const Record* record = 
+		reinterpret_cast<const Record*>(&m_arena[line.offset]);
+
+	/*
+	A line that is not kept in memory only leaves the arena while the
+	cold tier is empty, it is then the oldest line held:*/
+	if (_keep)
+		m_cold.append(record, line.bytes, line.first);
+	else if (m_spill.isOpen())
+		m_spill.append(record, line.bytes, line.first);
+
+	m_rowbase  += record->breaks + 1;
+	m_rowcount -= record->breaks + 1;
+	m_used     -= line.bytes;
+	m_lines.pop_front();
+
+	if (!_keep) {
+		m_coldbase = m_rowbase;
+		if (!m_spill.isOpen())
+			m_spillbase = m_rowbase;
+	}
+
+	if (!m_lines.empty())
+		m_head = m_lines.front().offset;
+}
+
+
+void Zconsole::Zscrollback::popColdBlock() {
+	m_cold.popBlock(m_spill);
+	m_coldbase = m_cold.empty() ? m_rowbase : m_cold.getFirstRow();
+
+	//lines are dropped once no file takes them, a failed
+	//write closes the file and drops what it held as well
+	if (!m_spill.isOpen())
+		m_spillbase = m_coldbase;
+}
+
+
+void Zconsole::Zscrollback::trim() {
+	//the oldest lines are in the cold tier, arena lines go once it is empty
+	while (getBytesHeld() > m_maxbytes) {
+		if (!m_cold.empty())
+			popColdBlock();
+		else if (m_lines.size() > 1)
+			popLine(false);
+		else break;
+	}
+}
+
+
+
+
+
+/* Section 2:
+** public interface functions
+******************************************************************************/
+Zconsole::Zscrollback::Zscrollback(
+	unsigned int       _maxlines, 
+	unsigned int       _maxbytes,
+	unsigned long long _retainbytes) :
+	m_lines(_maxlines),
+	m_arena(new unsigned char[_maxbytes]),
+	m_capacity(_maxbytes),
+	m_head(0),
+	m_tail(0),
+	m_used(0),
+	m_rowbase(0),
+	m_rowcount(0),
+	m_lasthit(0),
+	m_cold(ZCONSOLE_COLDBLOCKSIZE, ZCONSOLE_COLDCACHE),
+	m_coldbase(0),
+	m_maxbytes(_retainbytes),
+	m_spillbase(0),
+	m_logtable(nullptr),
+	m_logcache(ZCONSOLE_LOGCACHE) {
+
+	for (auto& entry : m_logcache)
+		entry.valid = false;
+}
+
+
+void Zconsole::Zscrollback::push(
+	const zstring&  _text, 
+	const zustring& _colors, 
+	unsigned int    _color,
+	unsigned int    _width) {
+	push(_text.data(), (unsigned int)_text.size(), _colors, _color, _width);
+}
+
+
+void Zconsole::Zscrollback::push(
+	const char*     _text, 
+	unsigned int    _size,
+	const zustring& _colors, 
+	unsigned int    _color,
+	unsigned int    _width) {
+
+	unsigned int charcount = 0u;
+	unsigned int size      = _size;
+
+	/*
+	A single record may never take more than a quarter of the arena, 
+	a longer line is stored as several records, cut at a wrap point
+	when the width allows it, so no text is lost:*/
+	unsigned int maxsize = getMaxRecordSize();
+	if (_width != 0 && maxsize >= _width)
+		maxsize -= maxsize % _width;
+	if (size > maxsize) {
+		for (unsigned int first = 0u; first < size; first += maxsize) {
+			const unsigned int count = std::min(maxsize, size - first);
+			const zustring colors = first < _colors.size() ? 
+				_colors.substr(first, count) : zustring();
+			push(_text + first, count, colors, _color, _width);
+		}
+		return;
+	}
+
+	//collapse per character colors into runs
+	m_runs.clear();
+	for (unsigned int i = 0u; i < size; ++i) {
+		const unsigned int color = i < _colors.size() ? _colors[i] : _color;
+		if (m_runs.empty() || m_runs.back().color != color) {
+			ColorRun run = { i, 0u, color };
+			m_runs.push_back(run);
+		}
+		++m_runs.back().length;
+	}
+
+	//break where a row goes over width or if we encounter a newline
+	m_breaks.clear();
+	for (unsigned int i = 0u; i < size; ++i) {
+		++charcount;
+		if (_text[i] == '\n' || charcount >= _width) {
+			if (i + 1u < size)
+				m_breaks.push_back(i + 1u);
+			charcount = 0u;
+		}
+	} 
+	const unsigned int breaks = (unsigned int)m_breaks.size();
+	const unsigned int runs   = (unsigned int)m_runs.size();
+	const unsigned int bytes  = 
+		sizeof(Record) + 
+		sizeof(ColorRun) * runs + 
+		sizeof(unsigned int) * breaks + 
+		((size + 3u) & ~3u);
+
+	if (m_lines.full())
+		popLine();
+	const unsigned int offset = allocate(bytes);
+
+	Record* record = reinterpret_cast<Record*>(&m_arena[offset]);
+	record->size   = size;
+	record->breaks = breaks;
+	record->runs   = runs;
+
+	ColorRun*     colors  = reinterpret_cast<ColorRun*>(record + 1);
+	unsigned int* offsets = reinterpret_cast<unsigned int*>(colors + runs);
+	if (runs != 0)
+		memcpy(colors, m_runs.data(), runs * sizeof(ColorRun));
+	if (breaks != 0) 
+		memcpy(offsets, m_breaks.data(), breaks * sizeof(unsigned int));
+	memcpy(offsets + breaks, _text, size);
+
+	LineRef line;
+	line.offset = offset;
+	line.bytes  = bytes;
+	line.first  = m_rowbase + m_rowcount;
+
+	if (m_lines.empty())
+		m_head = offset;
+	m_lines.push_back(line);
+	m_tail      = offset + bytes;
+	m_used     += bytes;
+	m_rowcount += breaks + 1;
+
+	trim();
+}
+
+
+void Zconsole::Zscrollback::pushLog(
+	unsigned int         _site,
+	const unsigned char* _args,
+	unsigned int         _size,
+	unsigned int         _color,
+	unsigned int         _width) {
+
+	const unsigned int bytes = 
+		sizeof(Record) + sizeof(LogRecord) + ((_size + 3u) & ~3u);
+
+	if (m_lines.full())
+		popLine();
+	const unsigned int offset = allocate(bytes);
+
+	Record* record = reinterpret_cast<Record*>(&m_arena[offset]);
+	record->size   = _size;
+	record->breaks = 0;
+	record->runs   = ZCONSOLE_LOGRECORD;
+
+	LogRecord* header = reinterpret_cast<LogRecord*>(record + 1);
+	header->site  = (unsigned short)_site;
+	header->width = (unsigned short)_width;
+	header->color = _color;
+	if (_size != 0)
+		memcpy(header + 1, _args, _size);
+
+	LineRef line;
+	line.offset = offset;
+	line.bytes  = bytes;
+	line.first  = m_rowbase + m_rowcount;
+
+	if (m_lines.empty())
+		m_head = offset;
+	m_lines.push_back(line);
+	m_tail      = offset + bytes;
+	m_used     += bytes;
+	m_rowcount += 1;
+
+	trim();
+}
+
+
+void Zconsole::Zscrollback::setLogTable(const ZlogTable* _table) {
+	m_logtable = _table;
+}
+
+
+void Zconsole::Zscrollback::clear() {
+	m_lines.clear();
+	m_head     = 0;
+	m_tail     = 0;
+	m_used     = 0;
+	m_rowbase  = 0;
+	m_rowcount = 0;
+
+	m_cold.clear();
+	m_coldbase = 0;
+
+	//row numbers start over, cached log lines would be mistaken
+	for (auto& entry : m_logcache)
+		entry.valid = false;
+
+	//start over with an empty spill file
+	m_spillbase = 0;
+	if (m_spill.isOpen()) {
+		const zstring filepath = m_spill.getFilePath();
+		m_spill.open(filepath);
+	}
+}
+
+
+Zconsole::Zscrollback::Row 
+Zconsole::Zscrollback::getRow(unsigned int _row) {
+	const Row emptyrow = { nullptr, 0, 0, nullptr, 0, 0 };
+
+	unsigned int first;
+
+	const Record* record = findRecord(m_spillbase + _row, first);
+	if (!record)
+		return emptyrow;
+	return cutRow(resolve(record, first), (m_spillbase + _row) - first);
+}
+
+
+bool Zconsole::Zscrollback::getLine(unsigned int _row, Line& _line) {
+	if (_row - m_spillbase >= getRowCount())
+		return false;
+
+	unsigned int first;
+
+	const Record* record = findRecord(_row, first);
+	if (!record)
+		return false;
+
+	const Parts parts = resolve(record, first);
+	_line.text  = parts.text;
+	_line.size  = parts.size;
+	_line.first = first;
+	_line.rows  = parts.breakcount + 1;
+	if (_line.size != 0 && _line.text[_line.size - 1] == '\n')
+		--_line.size;
+	return true;
+}
+
+
+bool Zconsole::Zscrollback::find(
+	const zstring& _pattern, 
+	bool           _forward, 
+	Match&         _match) {
+
+	const char*        pattern = _pattern.c_str();
+	const unsigned int length  = (unsigned int)_pattern.size();
+	const unsigned int count   = getRowCount();
+
+	unsigned int first  = _match.first;
+	unsigned int offset = 0;
+	unsigned int next;
+	bool         found  = false;
+
+	/*
+	Look in the rest of the current line first:*/
+	const Record* record = 
+		first - m_spillbase < count ? findRecord(first, first) : nullptr;
+	Parts parts;
+	if (record) {
+		parts = resolve(record, first);
+		if (_forward) {
+			const unsigned int from = _match.offset + 1;
+			found = from < parts.size && Zconsole_FindSubstring(
+				parts.text + from, parts.size - from, pattern, length, offset);
+			offset += from;
+		}
+		else {
+			//the last match that starts before the current one
+			const unsigned int size = 
+				std::min(parts.size, _match.offset + length - 1);
+			unsigned int from = 0;
+			unsigned int at;
+			while (from < size && Zconsole_FindSubstring(
+				parts.text + from, size - from, pattern, length, at)) {
+				offset = from + at;
+				from   = offset + 1;
+				found  = true;
+			}
+		}
+		next = _forward ? first + parts.breakcount + 1 : first - 1;
+	}
+	else next = _forward ? m_spillbase : m_spillbase + count - 1;
+
+	/*
+	Then whole lines, one after another:*/
+	while (!found && next - m_spillbase < count) {
+		record = findRecord(next, first);
+		if (!record)
+			return false;
+
+		parts = resolve(record, first);
+		if (_forward) 
+			found = Zconsole_FindSubstring(
+				parts.text, parts.size, pattern, length, offset);
+		else {
+			unsigned int from = 0;
+			unsigned int at;
+			while (from < parts.size && Zconsole_FindSubstring(
+				parts.text + from, parts.size - from, pattern, length, at)) {
+				offset = from + at;
+				from   = offset + 1;
+				found  = true;
+			}
+		}
+		next = _forward ? first + parts.breakcount + 1 : first - 1;
+	}
+	if (!found)
+		return false;
+
+	/*
+	Locate the rows the match starts and ends in:*/
+	unsigned int row  = 0;
+	unsigned int last = 0;
+	while (row < parts.breakcount && parts.breaks[row] <= offset)
+		++row;
+	last = row;
+	while (last < parts.breakcount && parts.breaks[last] < offset + length)
+		++last;
+
+	_match.first  = first;
+	_match.row    = first + row;
+	_match.last   = first + last;
+	_match.offset = offset;
+	return true;
+}
+
+
+unsigned int Zconsole::Zscrollback::getRowCount() const {
+	return (m_rowbase - m_spillbase) + m_rowcount;
+}
+
+
+unsigned int Zconsole::Zscrollback::getRowBase() const {
+	return m_spillbase;
+}
+
+
+unsigned int Zconsole::Zscrollback::getLineCount() const {
+	return m_lines.size();
+}
+
+
+unsigned int Zconsole::Zscrollback::getBytesUsed() const {
+	return m_used;
+}
+
+
+unsigned int Zconsole::Zscrollback::getMaxRecordSize() const {
+	//every character may start a row and a color run of its own
+	return 
+		(m_capacity / 4 - sizeof(Record)) / 
+		(sizeof(unsigned int) + sizeof(ColorRun) + 1);
+}
+
+
+bool Zconsole::Zscrollback::setSpill(const zstring& _filepath) {
+	//rows spilled so far go away with the file
+	m_spill.close();
+	m_spillbase = m_coldbase;
+
+	if (_filepath.empty())
+		return true;
+	return m_spill.open(_filepath);
+}
+
+
+unsigned int Zconsole::Zscrollback::getSpillCount() const {
+	return m_spill.size();
+}
+
+
+void Zconsole::Zscrollback::setMaxBytes(unsigned long long _bytes) {
+	m_maxbytes = _bytes;
+	trim();
+}
+
+
+unsigned long long Zconsole::Zscrollback::getMaxBytes() const {
+	return m_maxbytes;
+}
+
+
+unsigned long long Zconsole::Zscrollback::getBytesHeld() const {
+	return m_used + m_cold.getStoredBytes();
+}
+
+
+const Zconsole::ZcoldStore& Zconsole::Zscrollback::getColdStore() const {
+	return m_cold;
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
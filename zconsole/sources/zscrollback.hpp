@@ -0,0 +1,298 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zscrollback.hpp
+* Desc: arena backed storage for console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZSCROLLBACK_HPP__
+#define __ZSCROLLBACK_HPP__
+
+#include "zringbuffer.hpp"
+#include "zcoldstore.hpp"
+#include "zspillfile.hpp"
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::Zscrollback final  {
+public:
+	/*
+	A span of characters sharing one color*/
+	struct ColorRun {
+		unsigned int offset; //first character of the span
+		unsigned int length; //number of characters
+		unsigned int color;  //rgba color code
+	};
+	/*
+	One wrapped row of a line, pointing into the arena. The
+	color runs cover the whole line, not only this row*/
+	struct Row {
+		const char*     text;     //first character of the row
+		unsigned int    size;     //number of characters in the row
+		unsigned int    offset;   //offset of the row within its line
+		const ColorRun* runs;     //color runs of the line
+		unsigned int    runcount; //number of color runs
+		unsigned int    length;   //number of characters in the line
+	};
+	/*
+	A whole line, rows are numbered like getRowBase()*/
+	struct Line {
+		const char*  text;  //first character of the line
+		unsigned int size;  //number of characters, line break excluded
+		unsigned int first; //row number of the first row
+		unsigned int rows;  //number of wrapped rows
+	};
+	/*
+	Position of a search match, rows are numbered like getRowBase()*/
+	struct Match {
+		unsigned int first;  //row number of the first row of the line
+		unsigned int row;    //row number of the row the match starts in
+		unsigned int last;   //row number of the row the match ends in
+		unsigned int offset; //offset of the match within its line
+	};
+
+public: 
+	Zscrollback(
+		unsigned int       _maxlines, 
+		unsigned int       _maxbytes, 
+		unsigned long long _retainbytes);
+	~Zscrollback() {}	
+
+	/*
+	Append a line to the scrollback, the line is wrapped once here 
+	and stored back to back with its colors in the arena. Colors are
+	kept as runs, a single colored line holds one run. A line longer
+	than getMaxRecordSize() is split into several lines, cut at a row
+	boundary. The oldest lines are trimmed from the arena head until
+	the new line fits, then from the oldest end until the retention 
+	budget is met.
+	@_text  : the text of the line
+	@_colors: the color of each character, missing colors use _color
+	@_color : default color of the line
+	@_width : the number of columns rows are wrapped at*/
+	void push(
+		const zstring&  _text, 
+		const zustring& _colors, 
+		unsigned int    _color,
+		unsigned int    _width);
+
+	/*
+	Append a line given as a character range, the range may point
+	into a larger buffer so batched lines need no copy of their own.
+	@_text  : first character of the line
+	@_size  : number of characters in the line
+	@_colors: the color of each character, missing colors use _color
+	@_color : default color of the line
+	@_width : the number of columns rows are wrapped at*/
+	void push(
+		const char*     _text, 
+		unsigned int    _size,
+		const zustring& _colors, 
+		unsigned int    _color,
+		unsigned int    _width);
+
+	/*
+	Append a deferred log line. Only the log site and the raw bytes of
+	its arguments are stored, the text is formatted through the log 
+	table when the line is read. A log line takes a single row, text
+	past the wrap width is cut.
+	@_site : the id of the log site
+	@_args : the raw bytes of the arguments
+	@_size : the number of argument bytes
+	@_color: color of the line
+	@_width: the number of columns the row is cut at*/
+	void pushLog(
+		unsigned int         _site,
+		const unsigned char* _args,
+		unsigned int         _size,
+		unsigned int         _color,
+		unsigned int         _width);
+
+	/*
+	Set the table log lines are formatted with
+	@_table: the log table, must outlive the scrollback*/
+	void setLogTable(const ZlogTable* _table);
+
+	/*
+	Remove every line, the arena is kept*/
+	void clear();
+
+	/*
+	Returns a wrapped row, rows are numbered from the oldest one.
+	Rows of cold lines are read from their (decompressed) block 
+	and rows of spilled lines from the spill file.
+	@_row: the row to return, [0, getRowCount())*/
+	Row getRow(unsigned int _row);
+
+	/*
+	Returns the number of wrapped rows held, cold and spilled rows included*/
+	unsigned int getRowCount() const;
+
+	/*
+	Returns the row number of the oldest row held, row numbers keep 
+	growing as lines are added and getRow(0) is that row*/
+	unsigned int getRowBase() const;
+
+	/*
+	Returns the line holding a row. The text is valid until the
+	next lookup of a row or line.
+	@_row  : the row number, as getRowBase()
+	@_line : receives the line
+	@return: true if the row is held, else false*/
+	bool getLine(unsigned int _row, Line& _line);
+
+	/*
+	Search the lines for a text, from a match to the next one. Lines 
+	in the cold and disk tiers are read (decompressed) as they are 
+	searched.
+	@_pattern: the text to look for, lowercase, case is ignored
+	@_forward: true to search toward newer lines, false toward older
+	@_match  : the position to search from, receives the next match.
+	           A first row outside the rows held starts the search 
+	           from the oldest (forward) or newest (backward) line
+	@return  : true if a match was found*/
+	bool find(const zstring& _pattern, bool _forward, Match& _match);
+
+	/*
+	Enable or disable the on-disk tier. When enabled, lines trimmed
+	from the cold tier are appended to a file instead of being lost,
+	and stay reachable by scrolling. Only the rows being displayed 
+	are ever read back, through a memory mapping of the file.
+	@_filepath: path of the spill file, empty to disable
+	@return   : true on success, else false*/
+	bool setSpill(const zstring& _filepath);
+
+	/*
+	Returns the number of lines in the spill file*/
+	unsigned int getSpillCount() const;
+
+	/*
+	Returns the cold tier, lines trimmed from the arena are kept
+	there in compressed blocks until the tier is full*/
+	const ZcoldStore& getColdStore() const;
+
+	/*
+	Returns the number of lines held in the arena*/
+	unsigned int getLineCount() const;
+
+	/*
+	Returns the number of arena bytes held by lines*/
+	unsigned int getBytesUsed() const;
+
+	/*
+	Returns the longest line a single record holds, a quarter of the
+	arena in the worst case of one row and color run per character.
+	Longer lines are stored as several lines of at most that size*/
+	unsigned int getMaxRecordSize() const;
+
+	/*
+	Set how many bytes of memory lines may take, arena and cold tier
+	together. Lines are evicted from the oldest end until they fit, 
+	one at a time except for compressed blocks, which only go whole.
+	The newest line is always kept. Evicted lines go to the spill 
+	file when one is open.
+	@_bytes: the retention budget in bytes*/
+	void setMaxBytes(unsigned long long _bytes);
+
+	/*
+	Returns the retention budget in bytes*/
+	unsigned long long getMaxBytes() const;
+
+	/*
+	Returns the number of bytes of memory held by lines, arena and
+	cold tier together, this is what the retention budget limits*/
+	unsigned long long getBytesHeld() const;
+
+private:
+	/*
+	Arena layout of a line, followed by its color runs, its break 
+	offsets and its text, all 4 byte aligned. A log line has runs set
+	to ZCONSOLE_LOGRECORD and is followed by a LogRecord and the bytes
+	of its arguments instead, size is then the number of those bytes*/
+	struct Record {
+		unsigned int size;   //number of characters
+		unsigned int breaks; //number of wrapped rows after the first
+		unsigned int runs;   //number of color runs
+	};
+	/*
+	Header of the arguments of a log line*/
+	struct LogRecord {
+		unsigned short site;  //id of the log site
+		unsigned short width; //number of columns the row is cut at
+		unsigned int   color; //rgba color code
+	};
+	/*
+	A record resolved into its parts, log lines are formatted first*/
+	struct Parts {
+		const ColorRun*     runs;       //color runs of the line
+		unsigned int        runcount;   //number of color runs
+		const unsigned int* breaks;     //break offsets of the rows
+		unsigned int        breakcount; //number of break offsets
+		const char*         text;       //text of the line
+		unsigned int        size;       //number of characters
+	};
+	/*
+	A formatted log line, cached by the row number of the line*/
+	struct LogText {
+		unsigned int first; //row number of the line
+		bool         valid; //false until a line is formatted here
+		ColorRun     run;   //the whole line uses one color
+		zformat      line;  //the formatted text
+	};
+	/*
+	Index entry of a line*/
+	struct LineRef {
+		unsigned int offset; //arena offset of the record
+		unsigned int bytes;  //size of the record
+		unsigned int first;  //row number of the first row
+	};
+
+	unsigned int allocate(unsigned int _bytes);
+	void popLine(bool _keep = true);
+	void popColdBlock();
+	void trim();
+	const Record* findRecord(unsigned int _row, unsigned int& _first);
+	Parts resolve(const Record* _record, unsigned int _first);
+	static Row cutRow(const Parts& _parts, unsigned int _wrap);
+
+	ZringBuffer<LineRef>             m_lines;    //line index, oldest first
+	std::unique_ptr<unsigned char[]> m_arena;    //line records
+	unsigned int                     m_capacity; //arena size in bytes
+	unsigned int                     m_head;     //offset of the oldest record
+	unsigned int                     m_tail;     //offset of the next record
+	unsigned int                     m_used;     //bytes held by records
+	unsigned int                     m_rowbase;  //row number of the oldest row
+	unsigned int                     m_rowcount; //number of rows held
+	unsigned int                     m_lasthit;  //index of the line last looked up
+	ZcoldStore                       m_cold;     //compressed tier
+	unsigned int                     m_coldbase; //row number of the first cold row
+	unsigned long long               m_maxbytes; //retention budget of arena and cold tier
+	ZspillFile                       m_spill;    //on-disk tier, optional
+	unsigned int                     m_spillbase;//row number of the first spilled row
+	std::vector<unsigned int>        m_breaks;   //scratch for wrapping
+	std::vector<ColorRun>            m_runs;     //scratch for color runs
+	const ZlogTable*                 m_logtable; //formats log lines
+	std::vector<LogText>             m_logcache; //log lines formatted last
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -0,0 +1,285 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zspillfile.cpp
+* Desc: memory mapped on-disk tier for console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "zconsoledefs.hpp"
+#include "zspillfile.hpp"
+
+
+
+/* Section 1:
+** internal interface functions
+******************************************************************************/
+bool Zconsole::ZspillFile::map(
+	Mapping&       _mapping, 
+	FILE*          _file, 
+	const zstring& _filepath) {
+
+	unmap(_mapping);
+	fflush(_file);
+
+	/*
+	The whole file is mapped read only, pages are brought in
+	by the os as rows are read and can be dropped at any time:*/
+#if defined(_WIN32)
+	HANDLE file = CreateFileA(
+		_filepath.c_str(), 
+		GENERIC_READ, 
+		FILE_SHARE_READ | FILE_SHARE_WRITE, 
+		nullptr, 
+		OPEN_EXISTING, 
+		FILE_ATTRIBUTE_NORMAL, 
+		nullptr);
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+		CloseHandle(file);
+		return false;
+	}
+	HANDLE object = CreateFileMappingA(
+		file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (!object) {
+		CloseHandle(file);
+		return false;
+	}
+	void* data = MapViewOfFile(object, FILE_MAP_READ, 0, 0, 0);
+	if (!data) {
+		CloseHandle(object);
+		CloseHandle(file);
+		return false;
+	}
+	_mapping.data   = static_cast<const unsigned char*>(data);
+	_mapping.size   = (unsigned long long)size.QuadPart;
+	_mapping.handle = file;
+	_mapping.object = object;
+#else
+	const int file = ::open(_filepath.c_str(), O_RDONLY);
+	if (file < 0)
+		return false;
+
+	struct stat info;
+	if (fstat(file, &info) != 0 || info.st_size == 0) {
+		::close(file);
+		return false;
+	}
+	void* data = mmap(
+		nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, file, 0);
+	::close(file);
+	if (data == MAP_FAILED)
+		return false;
+
+	_mapping.data   = static_cast<const unsigned char*>(data);
+	_mapping.size   = (unsigned long long)info.st_size;
+	_mapping.handle = nullptr;
+	_mapping.object = nullptr;
+#endif
+	return true;
+}
+
+
+void Zconsole::ZspillFile::unmap(Mapping& _mapping) {
+	if (_mapping.data) {
+#if defined(_WIN32)
+		UnmapViewOfFile(_mapping.data);
+		CloseHandle(_mapping.object);
+		CloseHandle(_mapping.handle);
+#else
+		munmap(const_cast<unsigned char*>(_mapping.data), (size_t)_mapping.size);
+#endif
+	}
+	_mapping.data   = nullptr;
+	_mapping.size   = 0;
+	_mapping.handle = nullptr;
+	_mapping.object = nullptr;
+}
+
+
+const Zconsole::ZspillFile::Entry* 
+Zconsole::ZspillFile::getEntries(unsigned int _count) {
+	const unsigned long long end = 
+		(unsigned long long)_count * sizeof(Entry);
+
+	//the views only cover what was written when they were made
+	if (end > m_indexmap.size && 
+		!map(m_indexmap, m_index, m_filepath + ".idx"))
+		return nullptr;
+	return reinterpret_cast<const Entry*>(m_indexmap.data);
+}
+
+
+
+
+
+/* Section 2:
+** public interface functions
+******************************************************************************/
+Zconsole::ZspillFile::ZspillFile() :
+	m_records(nullptr),
+	m_index(nullptr),
+	m_bytes(0),
+	m_count(0),
+	m_lasthit(0) {
+
+	const Mapping empty = { nullptr, 0, nullptr, nullptr };
+	m_recordmap = empty;
+	m_indexmap  = empty;
+}
+
+
+Zconsole::ZspillFile::~ZspillFile() {
+	close();
+}
+
+
+bool Zconsole::ZspillFile::open(const zstring& _filepath) {
+	close();
+
+	m_records = fopen(_filepath.c_str(), "wb");
+	m_index   = fopen((_filepath + ".idx").c_str(), "wb");
+	if (!m_records || !m_index) {
+		close();
+		return false;
+	}
+	m_filepath = _filepath;
+	return true;
+}
+
+
+void Zconsole::ZspillFile::close() {
+	unmap(m_recordmap);
+	unmap(m_indexmap);
+
+	if (m_records)
+		fclose(m_records);
+	if (m_index)
+		fclose(m_index);
+
+	m_records = nullptr;
+	m_index   = nullptr;
+	m_bytes   = 0;
+	m_count   = 0;
+	m_lasthit = 0;
+	m_filepath.clear();
+}
+
+
+bool Zconsole::ZspillFile::isOpen() const {
+	return m_records != nullptr;
+}
+
+
+void Zconsole::ZspillFile::append(
+	const void*  _record, 
+	unsigned int _bytes, 
+	unsigned int _first) {
+
+	Entry entry;
+	entry.offset = m_bytes;
+	entry.bytes  = _bytes;
+	entry.first  = _first;
+
+	if (fwrite(_record, 1, _bytes, m_records) != _bytes ||
+		fwrite(&entry, sizeof(Entry), 1, m_index) != 1) {
+		//a full disk stops spilling, resident lines are unaffected
+		close();
+		return;
+	}
+	m_bytes += _bytes;
+	++m_count;
+}
+
+
+unsigned int Zconsole::ZspillFile::size() const {
+	return m_count;
+}
+
+
+const unsigned char* Zconsole::ZspillFile::find(
+	unsigned int  _row, 
+	unsigned int& _first) {
+
+	const Entry* entries = getEntries(m_count);
+	if (!entries || m_count == 0)
+		return nullptr;
+
+	/*
+	Row numbers only ever grow, so the index is sorted by them. Rows
+	are mostly looked up in order, try around the last hit first:*/
+	const unsigned int base = entries[0].first;
+	const unsigned int row  = _row - base;
+
+	unsigned int lo = 0;
+	unsigned int hi = m_count;
+	for (unsigned int i = 0; i < 3; ++i) {
+		const unsigned int hint = m_lasthit + i - 1;
+		if (hint < m_count && 
+			entries[hint].first - base <= row &&
+			(hint + 1 == m_count || entries[hint + 1].first - base > row)) {
+			lo = hi = hint;
+			break;
+		}
+	}
+	while (hi - lo > 1) {
+		const unsigned int mid = lo + (hi - lo) / 2;
+		if (entries[mid].first - base <= row)
+			lo = mid;
+		else
+			hi = mid;
+	}
+	m_lasthit = lo;
+
+	const Entry entry = entries[lo];
+
+	if (entry.offset + entry.bytes > m_recordmap.size &&
+		!map(m_recordmap, m_records, m_filepath))
+		return nullptr;
+
+	_first = entry.first;
+	return m_recordmap.data + entry.offset;
+}
+
+
+unsigned long long Zconsole::ZspillFile::getBytes() const {
+	return m_bytes;
+}
+
+
+const zstring& Zconsole::ZspillFile::getFilePath() const {
+	return m_filepath;
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
@@ -0,0 +1,115 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zspillfile.hpp
+* Desc: memory mapped on-disk tier for console scrollback
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZSPILLFILE_HPP__
+#define __ZSPILLFILE_HPP__
+
+#include <cstdio>
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::ZspillFile final : sf::NonCopyable {
+public: 
+	ZspillFile();
+	~ZspillFile();	
+
+	/*
+	Create (or truncate) the spill file and its line index,
+	any previously open file is closed first.
+	@_filepath: path of the spill file, the index is stored
+	            next to it with an ".idx" extension
+	@return   : true on success, else false*/
+	bool open(const zstring& _filepath);
+
+	/*
+	Close the spill file and release its mappings, 
+	the files are left on disk*/
+	void close();
+
+	/*
+	Returns true if lines are being spilled to a file*/
+	bool isOpen() const;
+
+	/*
+	Append a scrollback record to the end of the file.
+	@_record: the record, as stored in the scrollback arena
+	@_bytes : size of the record
+	@_first : row number of the first row of the line*/
+	void append(const void* _record, unsigned int _bytes, unsigned int _first);
+
+	/*
+	Returns the number of lines in the file*/
+	unsigned int size() const;
+
+	/*
+	Find the line holding a row and return its record, read through 
+	the mapping of the file. The pointer is valid until the next call.
+	@_row  : the row number to look for
+	@_first: receives the row number of the first row of the line
+	@return: the record, or nullptr if the file could not be mapped*/
+	const unsigned char* find(unsigned int _row, unsigned int& _first);
+
+	/*
+	Returns the number of bytes written to the file*/
+	unsigned long long getBytes() const;
+
+	/*
+	Returns the path of the spill file, empty if none is open*/
+	const zstring& getFilePath() const;
+
+private:
+	/*
+	Line index entry, stored in the index file*/
+	struct Entry {
+		unsigned long long offset; //offset of the record in the file
+		unsigned int       bytes;  //size of the record
+		unsigned int       first;  //row number of the first row
+	};
+	/*
+	A read only view of a whole file*/
+	struct Mapping {
+		const unsigned char* data;   //first byte of the view
+		unsigned long long   size;   //size of the view
+		void*                handle; //platform handles of the view
+		void*                object;
+	};
+
+	bool map(Mapping& _mapping, FILE* _file, const zstring& _filepath);
+	void unmap(Mapping& _mapping);
+	const Entry* getEntries(unsigned int _count);
+
+	zstring            m_filepath;  //path of the record file
+	FILE*              m_records;   //record file, append only
+	FILE*              m_index;     //index file, append only
+	Mapping            m_recordmap; //view of the record file
+	Mapping            m_indexmap;  //view of the index file
+	unsigned long long m_bytes;     //bytes written to the record file
+	unsigned int       m_count;     //number of lines written
+	unsigned int       m_lasthit;   //index of the entry last looked up
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
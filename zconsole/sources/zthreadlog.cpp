@@ -0,0 +1,177 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zthreadlog.cpp
+* Desc: per thread line buffers merged once per frame
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#include <chrono>
+#include <cstring>
+#include "zconsoledefs.hpp"
+#include "zthreadlog.hpp"
+
+
+
+thread_local Zconsole::ZthreadLog::Slot Zconsole::ZthreadLog::m_slot;
+
+//generation of the next instance, 0 is never handed out
+static std::atomic<unsigned int> s_zthreadlog_generation(1);
+
+
+
+
+
+/* Section 1:
+** internal interface functions
+******************************************************************************/
+Zconsole::ZthreadLog::Slot::~Slot() {
+	if (buffer)
+		buffer->exited.store(true, std::memory_order_release);
+}
+
+
+Zconsole::ZthreadLog::Buffer* Zconsole::ZthreadLog::attach() {
+	//a thread logging to another console leaves its old buffer
+	if (m_slot.buffer)
+		m_slot.buffer->exited.store(true, std::memory_order_release);
+
+	std::shared_ptr<Buffer> buffer = std::make_shared<Buffer>();
+	buffer->data.reset(new unsigned char[ZCONSOLE_THREADBUFFER]);
+	buffer->lines    = 0;
+	buffer->reported = 0;
+	buffer->exited.store(false, std::memory_order_relaxed);
+	buffer->dropped.store(0, std::memory_order_relaxed);
+	buffer->write.store(0, std::memory_order_relaxed);
+	buffer->seen = 0;
+	buffer->read.store(0, std::memory_order_relaxed);
+
+	std::lock_guard<std::mutex> lock(m_mutex);
+	buffer->id = ++m_nextid;
+	m_buffers.push_back(buffer);
+
+	m_slot.buffer     = buffer;
+	m_slot.generation = m_generation;
+	return buffer.get();
+}
+
+
+const Zconsole::ZthreadLog::Entry* 
+Zconsole::ZthreadLog::peek(Head& _head) {
+	while (_head.read != _head.end) {
+		const unsigned int offset = _head.read & (ZCONSOLE_THREADBUFFER - 1);
+		const Entry* entry = reinterpret_cast<const Entry*>(
+			&_head.buffer->data[offset]);
+
+		if (entry->size != ZCONSOLE_THREADSKIP)
+			return entry;
+		_head.read += ZCONSOLE_THREADBUFFER - offset;
+	}
+	return nullptr;
+}
+
+
+
+
+
+/* Section 2:
+** public interface functions
+******************************************************************************/
+Zconsole::ZthreadLog::ZthreadLog() :
+	m_nextid(0),
+	m_generation(s_zthreadlog_generation.fetch_add(1)) {}
+
+
+bool Zconsole::ZthreadLog::push(zstrview _text) {
+	Buffer* buffer = 
+		m_slot.generation == m_generation ? m_slot.buffer.get() : attach();
+
+	const unsigned int size  = (unsigned int)
+		(_text.size() < ZCONSOLE_QUEUELINE ? _text.size() : ZCONSOLE_QUEUELINE);
+	const unsigned int bytes = (sizeof(Entry) + size + 15u) & ~15u;
+
+	/*
+	The line goes at the write position, or at the start of the buffer 
+	if it does not fit before the end. The read position is only looked
+	up again when the last one seen leaves no room:*/
+	unsigned int       write  = buffer->write.load(std::memory_order_relaxed);
+	const unsigned int offset = write & (ZCONSOLE_THREADBUFFER - 1);
+	const unsigned int tail   = ZCONSOLE_THREADBUFFER - offset;
+	const unsigned int needed = bytes <= tail ? bytes : tail + bytes;
+
+	if (ZCONSOLE_THREADBUFFER - (write - buffer->seen) < needed) {
+		buffer->seen = buffer->read.load(std::memory_order_acquire);
+		if (ZCONSOLE_THREADBUFFER - (write - buffer->seen) < needed) {
+			buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+	}
+	if (bytes > tail) {
+		reinterpret_cast<Entry*>(&buffer->data[offset])->size = 
+			ZCONSOLE_THREADSKIP;
+		write += tail;
+	}
+
+	Entry* entry = reinterpret_cast<Entry*>(
+		&buffer->data[write & (ZCONSOLE_THREADBUFFER - 1)]);
+	entry->stamp = (unsigned long long)
+		std::chrono::steady_clock::now().time_since_epoch().count();
+	entry->size  = size;
+	if (size != 0)
+		memcpy(entry + 1, _text.data(), size);
+
+	//publish the line to the console thread
+	buffer->write.store(write + bytes, std::memory_order_release);
+	return true;
+}
+
+
+unsigned int Zconsole::ZthreadLog::takeDropped() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	unsigned int count = 0;
+	for (const auto& buffer : m_buffers) {
+		const unsigned int dropped = 
+			buffer->dropped.load(std::memory_order_relaxed);
+		count += dropped - buffer->reported;
+		buffer->reported = dropped;
+	}
+	return count;
+}
+
+
+std::vector<Zconsole::ZthreadLog::Thread> 
+Zconsole::ZthreadLog::getThreads() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	std::vector<Thread> threads;
+	for (const auto& buffer : m_buffers) {
+		Thread thread;
+		thread.id      = buffer->id;
+		thread.lines   = buffer->lines;
+		thread.dropped = buffer->dropped.load(std::memory_order_relaxed);
+		thread.exited  = buffer->exited.load(std::memory_order_relaxed);
+		threads.push_back(thread);
+	}
+	return threads;
+}
+/*****************************************************************************/  
+//EOF
+/*****************************************************************************/  
@@ -0,0 +1,194 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zthreadlog.hpp
+* Desc: per thread line buffers merged once per frame
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/
+#ifndef __ZTHREADLOG_HPP__
+#define __ZTHREADLOG_HPP__
+
+#include <atomic>
+#include <mutex>
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::ZthreadLog final : sf::NonCopyable {
+public:
+	/*
+	A thread that logged lines*/
+	struct Thread {
+		unsigned int       id;      //id shown on the lines of the thread
+		unsigned long long lines;   //number of lines collected
+		unsigned int       dropped; //number of lines dropped while full
+		bool               exited;  //true once the thread is gone
+	};
+
+public: 
+	ZthreadLog();
+	~ZthreadLog() {}	
+
+	/*
+	Append a line to the buffer of the calling thread, any thread may
+	call this. A thread gets its buffer (and its id) the first time 
+	it logs, later lines are a clock read and a copy into memory only
+	that thread writes, with no lock and no shared counter. Lines are
+	dropped and counted while the buffer is full.
+	@_text : the text of the line, cut to ZCONSOLE_QUEUELINE characters
+	@return: true if the line was buffered, false if it was dropped*/
+	bool push(zstrview _text);
+
+	/*
+	Collect the buffered lines of every thread, merged by the time
+	they were logged, on the thread that owns the console. Buffers of
+	threads that exited are released once empty.
+	@_sink : called as _sink(unsigned int _id, const char* _text, 
+	         unsigned int _size), the text is only valid during the call
+	@return: the number of lines collected*/
+	template <typename Sink>
+	unsigned int collect(Sink&& _sink);
+
+	/*
+	Returns the number of lines dropped since the last call, 
+	on the thread that owns the console*/
+	unsigned int takeDropped();
+
+	/*
+	Returns the threads that logged and still have a buffer*/
+	std::vector<Thread> getThreads() const;
+
+private:
+	/*
+	Buffer layout of a line, followed by its text. Entries are 16 byte
+	aligned so the end of the buffer always fits a header, a header 
+	with size ZCONSOLE_THREADSKIP sends the reader back to the start*/
+	struct Entry {
+		unsigned long long stamp; //time the line was logged
+		unsigned int       size;  //number of characters
+		unsigned int       pad;   
+	};
+	/*
+	The buffer of one thread, a single producer single consumer ring.
+	Positions only grow, the producer and the consumer each own one*/
+	struct Buffer {
+		std::unique_ptr<unsigned char[]> data;     
+		unsigned int                     id;       //id of the thread
+		unsigned long long               lines;    //lines collected, consumer
+		unsigned int                     reported; //drops already taken, consumer
+		std::atomic<bool>                exited;   //set by the thread on exit
+		std::atomic<unsigned int>        dropped;  //lines dropped while full
+		alignas(64)
+		std::atomic<unsigned int>        write;    //next position, producer
+		unsigned int                     seen;     //read position last seen, producer
+		alignas(64)
+		std::atomic<unsigned int>        read;     //next position, consumer
+	};
+	/*
+	The buffer of the calling thread, marks it exited on thread exit.
+	The owner is known by its generation, an address may be reused*/
+	struct Slot {
+		std::shared_ptr<Buffer> buffer;     
+		unsigned int            generation; 
+		Slot() : generation(0) {}
+		~Slot();
+	};
+	/*
+	Merge state of one buffer during a collection*/
+	struct Head {
+		Buffer*      buffer; //the buffer
+		unsigned int read;   //next position to read
+		unsigned int end;    //position written when the collection began
+	};
+
+	Buffer* attach();
+	static const Entry* peek(Head& _head);
+
+	static thread_local Slot             m_slot;       //buffer of the calling thread
+	mutable std::mutex                   m_mutex;      //guards the buffer list
+	std::vector<std::shared_ptr<Buffer>> m_buffers;    //buffers, oldest thread first
+	std::vector<Head>                    m_heads;      //scratch for merging
+	unsigned int                         m_nextid;     //id of the next thread
+	const unsigned int                   m_generation; //tells instances apart
+};
+
+
+
+template <typename Sink>
+unsigned int Zconsole::ZthreadLog::collect(Sink&& _sink) {
+	{//only lines written before the collection began are taken
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_heads.clear();
+		for (const auto& buffer : m_buffers) {
+			Head head;
+			head.buffer = buffer.get();
+			head.read   = buffer->read.load(std::memory_order_relaxed);
+			head.end    = buffer->write.load(std::memory_order_acquire);
+			if (head.read != head.end)
+				m_heads.push_back(head);
+		}
+	}
+	/*
+	The sink runs without the lock, a thread logging for the first 
+	time does not wait for the console to print. Buffers are only 
+	released below, by this thread, so the heads stay valid.
+	Each buffer is already in time order, take the oldest line of 
+	all the buffers until every one is empty:*/
+
+	unsigned int count = 0;
+	for (;;) {
+		Head*        oldest = nullptr;
+		const Entry* entry  = nullptr;
+		for (auto& head : m_heads) {
+			const Entry* next = peek(head);
+			if (next && (!entry || next->stamp < entry->stamp)) {
+				oldest = &head;
+				entry  = next;
+			}
+		}
+		if (!oldest)
+			break;
+
+		_sink(oldest->buffer->id, 
+			reinterpret_cast<const char*>(entry + 1), entry->size);
+		oldest->read += (sizeof(Entry) + entry->size + 15u) & ~15u;
+		++oldest->buffer->lines;
+		++count;
+	}
+	for (auto& head : m_heads)
+		head.buffer->read.store(head.read, std::memory_order_release);
+
+	//a thread that exited writes no more, its buffer goes once read
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (unsigned int i = 0; i < m_buffers.size(); ) {
+		const Buffer& buffer = *m_buffers[i];
+		if (buffer.exited.load(std::memory_order_acquire) &&
+			buffer.read.load(std::memory_order_relaxed) == 
+			buffer.write.load(std::memory_order_acquire) &&
+			buffer.reported == buffer.dropped.load(std::memory_order_relaxed))
+			m_buffers.erase(m_buffers.begin() + i);
+		else ++i;
+	}
+	return count;
+}
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  
@@ -0,0 +1,117 @@
+/******************************************************************************
+* zconsole - sfml based in-game console module 
+* Copyright (C) 2020-2021 Zachary T Harris. All Rights Reserved.  
+* 
+* File: zvertexarena.hpp
+* Desc: fixed layout storage for console vertices
+*******************************************************************************
+
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+******************************************************************************/ 
+#ifndef __ZVERTEXARENA_HPP__
+#define __ZVERTEXARENA_HPP__
+
+#include "zconsole/zconsole.hpp"
+
+
+
+class Zconsole::ZvertexArena final : sf::NonCopyable {
+public: 
+	ZvertexArena() : m_count(0) {}
+	~ZvertexArena() {}	
+
+	/*
+	Allocate storage for a console grid, laid out as
+	[background | frame | text] with 6 vertices (2 triangles)
+	per slot. This is the only allocation the arena ever makes.
+	@_width : number of columns in the grid
+	@_height: number of rows in the grid*/
+	void create(unsigned int _width, unsigned int _height) {
+		m_width  = _width;
+		m_frame  = 6;
+		m_text   = m_frame + ((2 * (_width + _height) - 4) * 6);
+		m_count  = m_text + ((_width - 2) * (_height - 2) * 6);
+		m_vertices.reset(new sf::Vertex[m_count]);
+	}
+
+	/*
+	Returns the total number of vertices in the arena*/
+	inline unsigned int size() const { 
+		return m_count; 
+	}
+
+	/*
+	Returns the first vertex of the arena*/
+	inline sf::Vertex* data() { 
+		return m_vertices.get(); 
+	}
+	inline const sf::Vertex* data() const { 
+		return m_vertices.get(); 
+	}
+
+	/*
+	Returns the 6 vertices of the background quad*/
+	inline sf::Vertex* getBackground() { 
+		return &m_vertices[0]; 
+	}
+
+	/*
+	Returns the 6 vertices of a border cell, borders are
+	numbered in row order around the grid.
+	@_index: index of the border cell*/
+	inline sf::Vertex* getFrame(unsigned int _index) { 
+		return &m_vertices[m_frame + (_index * 6)]; 
+	}
+
+	/*
+	Returns the 6 vertices of an interior cell.
+	@_coordx: column of the cell, [1, width - 1)
+	@_coordy: row of the cell, [1, height - 1)*/
+	inline sf::Vertex* getText(unsigned int _coordx, unsigned int _coordy) { 
+		return &m_vertices[getTextOffset(_coordy) + ((_coordx - 1) * 6)]; 
+	}
+
+	/*
+	Returns the index of the first border vertex*/
+	inline unsigned int getFrameOffset() const { 
+		return m_frame; 
+	}
+
+	/*
+	Returns the index of the first vertex of an interior row.
+	@_coordy: row of the grid, [1, height - 1)*/
+	inline unsigned int getTextOffset(unsigned int _coordy) const { 
+		return m_text + ((_coordy - 1) * (m_width - 2) * 6); 
+	}
+
+	/*
+	Returns the number of vertices in one interior row*/
+	inline unsigned int getTextRowSize() const { 
+		return (m_width - 2) * 6; 
+	}
+
+private:
+	std::unique_ptr<sf::Vertex[]> m_vertices; //the whole layout
+	unsigned int                  m_count;    //number of vertices
+	unsigned int                  m_width;    //columns in the grid
+	unsigned int                  m_frame;    //first border vertex
+	unsigned int                  m_text;     //first interior vertex
+};
+/*****************************************************************************/  
+#endif //EOF
+/*****************************************************************************/  